@@ -20,9 +20,17 @@
 #include "toy_compiler/munster/visitor/symbol_table/memory_size_visitor.hpp"
 #include <toy_compiler/core/application.hpp>
 
+#include <toy_compiler/munster/ast/traversal.hpp>
+#include <toy_compiler/munster/ir/constant_folding.hpp>
+#include <toy_compiler/munster/ir/dead_code_elimination.hpp>
+#include <toy_compiler/munster/ir/moon_emitter.hpp>
+#include <toy_compiler/munster/ir/peephole.hpp>
+#include <toy_compiler/munster/utility.hpp>
+#include <toy_compiler/munster/visitor/pass_manager.hpp>
 #include <toy_compiler/munster/visitor/semantic_checking/type_checking_visitor.hpp>
 #include <toy_compiler/munster/visitor/symbol_table/symbol_table_visitor.hpp>
 #include <toy_compiler/munster/visitor/visitor.hpp>
+#include <toy_compiler/util/parallel_for.hpp>
 
 #include <fmt/color.h>
 #include <fmt/ostream.h>
@@ -33,8 +41,10 @@
 
 #include <mpark/patterns.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <string_view>
 
 namespace fs = std::filesystem;
 
@@ -45,6 +55,23 @@ auto pop(std::vector<munster::ast::node*>& stack) -> munster::ast::node*
    return temp;
 }
 
+// records every step of the parse and writes it to the .outderivation of each source
+constexpr std::string_view trace_derivations_flag = "--trace-derivations";
+
+// sizing the locals of the functions on several threads only pays off past this many functions
+constexpr std::size_t min_functions_sized_in_parallel = 256;
+
+auto function_count(const munster::ast::node& root) -> std::size_t
+{
+   const auto& children = root.children();
+   if (std::size(children) < 2 || !children[1])
+   {
+      return 0;
+   }
+
+   return std::size(children[1]->children());
+}
+
 void print_errors(std::span<const munster::parse_error> errors,
                   const std::filesystem::path& filepath)
 {
@@ -70,53 +97,105 @@ void print_errors(std::span<const munster::parse_error> errors,
 application::application(std::span<const std::string_view> args, util::logger_wrapper log) :
    m_logger{log}
 {
+   const bool trace_derivations = std::ranges::find(args, trace_derivations_flag) != std::end(args);
+
    for (const auto filename : args)
    {
+      if (filename == trace_derivations_flag)
+      {
+         continue;
+      }
+
       const auto filepath = fs::path{filename};
       if (filepath.extension() == ".src")
       {
-         if (auto maybe = munster::lex_file(filepath, m_logger))
+         const auto buffer = munster::open_source_buffer(filepath);
+         const auto tokens =
+            munster::make_token_stream(buffer ? buffer->view() : std::string_view{}, m_logger);
+         if (buffer && tokens)
          {
-            const auto result = munster::parse_items(maybe.value(), m_logger);
+            const auto result = munster::parse_tokens(
+               tokens.value(), munster::parse_options{.trace_derivations = trace_derivations},
+               m_logger);
             if (result.value == munster::parse_status::error)
             {
                print_errors(result.errors.value(), filepath);
             }
 
-            write_lexing_to_file(filepath, maybe.value());
+            write_lexing_to_file(filepath, tokens.value());
             write_ast_to_file(filepath, result.ast);
-            write_derivations_to_file(filepath, result.derivation);
+            if (trace_derivations)
+            {
+               write_derivations_to_file(filepath, result.derivation, buffer->view());
+            }
 
             {
-               using namespace mpark::patterns;
                using namespace munster;
 
-               ast::visitor_variant st_variant{symbol_table_visitor{}};
-               result.ast->accept(st_variant);
-
-               auto [has_error, p_root_table] = match(st_variant)(
-                  pattern(as<symbol_table_visitor>(arg)) =
-                     [&](symbol_table_visitor& vis) -> std::pair<bool, symbol_table*> {
-                     print_errors(vis.get_errors(), filepath);
-
-                     return {!std::empty(vis.get_errors()), vis.get_root_table()};
-                  });
-
-               ast::visitor_variant ms_variant{memory_size_visitor{p_root_table}};
-               result.ast->accept(ms_variant);
-
-               write_symbol_tables_to_file(filepath, p_root_table);
-
-               if (!has_error)
-               {
-                  ast::visitor_variant cg_variant{code_gen_visitor{p_root_table}};
-                  result.ast->accept(cg_variant);
-
-                  match(cg_variant)(
-                     pattern(as<code_gen_visitor>(arg)) = [&](code_gen_visitor& vis) {
-                        write_moon_code_to_file(filepath, vis.moon_code());
-                     });
-               }
+               bool has_error = false;
+               symbol_table* p_root_table = nullptr;
+
+               pass_manager passes;
+               passes
+                  .add({.name = "symbol_table",
+                        .dependencies = {},
+                        .make = []() -> monad::maybe<ast::visitor_variant> {
+                           return ast::visitor_variant{symbol_table_visitor{}};
+                        },
+                        .finish =
+                           [&](ast::visitor_variant& visitor) {
+                              auto& vis = std::get<symbol_table_visitor>(visitor);
+                              print_errors(vis.get_errors(), filepath);
+
+                              has_error = !std::empty(vis.get_errors());
+                              p_root_table = vis.get_root_table();
+                           }})
+                  .add({.name = "memory_size",
+                        .dependencies = {"symbol_table"},
+                        .make = [&]() -> monad::maybe<ast::visitor_variant> {
+                           const auto thread_count =
+                              function_count(*result.ast) >= min_functions_sized_in_parallel
+                                 ? util::hardware_thread_count()
+                                 : 1;
+
+                           return ast::visitor_variant{
+                              memory_size_visitor{p_root_table, thread_count}};
+                        },
+                        .finish =
+                           [&](ast::visitor_variant& /*visitor*/) {
+                              write_symbol_tables_to_file(filepath, p_root_table);
+                           }})
+                  .add({.name = "code_gen",
+                        .dependencies = {"memory_size"},
+                        .make = [&]() -> monad::maybe<ast::visitor_variant> {
+                           if (has_error)
+                           {
+                              return monad::none;
+                           }
+
+                           return ast::visitor_variant{code_gen_visitor{p_root_table}};
+                        },
+                        .finish =
+                           [&](ast::visitor_variant& visitor) {
+                              auto& vis = std::get<code_gen_visitor>(visitor);
+                              auto program = vis.take_program();
+                              ir::fold_constants(program);
+                              ir::eliminate_dead_code(program);
+
+                              auto moon_code = ir::emit_moon_lines(program);
+                              const auto rules = ir::default_peephole_rules();
+                              const auto fired = ir::run_peephole(moon_code, rules);
+                              for (std::size_t i = 0; i < std::size(rules); ++i)
+                              {
+                                 m_logger.info("peephole rule \"{}\" fired {} times",
+                                               rules[i].name, fired[i]);
+                              }
+
+                              write_moon_code_to_file(filepath, ir::format_moon(moon_code));
+                           }});
+
+               [[maybe_unused]] const auto traversals = passes.run(*result.ast);
+               assert(traversals); // NOLINT
 
                /*
                ast::visitor_variant tc_variant{type_checking_visitor{root_table}};
@@ -150,14 +229,27 @@ application::application(std::span<const std::string_view> args, util::logger_wr
 }
 
 void application::write_lexing_to_file(const std::filesystem::path& path,
-                                       const std::span<munster::lex_item>& items) const
+                                       munster::token_stream tokens) const
 {
    auto output_path = path.parent_path();
    output_path /= path.stem();
    output_path += ".outlextokens";
 
    std::ofstream output_file{output_path};
-   fmt::print(output_file, "{}", fmt::join(items, "\n"));
+   const auto source = tokens.source();
+   while (true)
+   {
+      const auto item = tokens.next();
+      const munster::grammar::token_type type = item.type;
+
+      fmt::print(output_file, "[.type = {}, .lexeme = {}, .position = {}]\n", type,
+                 munster::to_literal(munster::lexeme(item, source)), item.pos);
+
+      if (munster::grammar::is_eof(type))
+      {
+         break;
+      }
+   }
 }
 
 void application::write_moon_code_to_file(const std::filesystem::path& path,
@@ -171,38 +263,16 @@ void application::write_moon_code_to_file(const std::filesystem::path& path,
    fmt::print(output_file, "{}", code);
 }
 
-void application::write_derivations_to_file(const std::filesystem::path& path,
-                                            const std::string& derivation) const
+void application::write_derivations_to_file(
+   const std::filesystem::path& path, std::span<const munster::derivation_event> derivation,
+   std::string_view source) const
 {
    auto output_path = path.parent_path();
    output_path /= path.stem();
    output_path += ".outderivation";
 
    std::ofstream output_file{output_path};
-   fmt::print(output_file, "{}", derivation);
-}
-
-void pre_order_traversal(const munster::ast::node_ptr& node, std::size_t depth,
-                         std::ofstream& output_file)
-{
-   if (!node)
-   {
-      return;
-   }
-
-   const auto name = fmt::format("- {}\n", node);
-   fmt::print(output_file, "{:>{}}", name, std::size(name) + depth * 2);
-   // fmt::print("{:>{}}", name, std::size(name) + depth * 2);
-
-   for (const auto& child : node->children())
-   {
-      pre_order_traversal(child, depth + 1, output_file);
-   }
-
-   if (std::empty(node->children()))
-   {
-      pre_order_traversal({}, depth + 1, output_file);
-   }
+   munster::write_derivations(output_file, derivation, source);
 }
 
 void application::write_ast_to_file(const std::filesystem::path& path,
@@ -214,7 +284,17 @@ void application::write_ast_to_file(const std::filesystem::path& path,
 
    std::ofstream output_file{output_path};
 
-   pre_order_traversal(root, 0, output_file);
+   if (!root)
+   {
+      return;
+   }
+
+   munster::ast::pre_order(*root, [&](const munster::ast::node& node, std::size_t depth) {
+      const auto name = fmt::format("- {}\n", node);
+      fmt::print(output_file, "{:>{}}", name, std::size(name) + depth * 2);
+
+      return munster::ast::traversal_action::e_continue;
+   });
 }
 
 void st_pre_order_traversal(const munster::symbol_table* root, std::ofstream& output_file)
@@ -32,14 +32,19 @@
 class application
 {
 public:
+   /**
+    * @brief Compile every `.src` file of `args`. The steps of each parse are only recorded and
+    * written to its `.outderivation` file when `--trace-derivations` is among `args`
+    */
    application(std::span<const std::string_view> args, util::logger_wrapper log = nullptr);
 
 private:
    void write_lexing_to_file(const std::filesystem::path& path,
-                             const std::span<munster::lex_item>& items) const;
+                             munster::token_stream tokens) const;
    void write_moon_code_to_file(const std::filesystem::path& path, std::string_view code) const;
    void write_derivations_to_file(const std::filesystem::path& path,
-                                  const std::string& derivation) const;
+                                  std::span<const munster::derivation_event> derivation,
+                                  std::string_view source) const;
    void write_ast_to_file(const std::filesystem::path& path,
                           const munster::ast::node_ptr& root) const;
    void write_symbol_tables_to_file(const std::filesystem::path& path,
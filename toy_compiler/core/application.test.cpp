@@ -56,4 +56,24 @@ TEST_SUITE("Application test suite")
       CHECK(std::filesystem::exists(file_test));
       CHECK(std::filesystem::exists(output_test));
    }
+   TEST_CASE("derivations are only written when traced")
+   {
+      std::string filepath = "test_files/bubblesort.src";
+      std::filesystem::path output_derivation{"test_files/bubblesort.outderivation"};
+
+      std::filesystem::remove(output_derivation);
+
+      {
+         std::vector<std::string_view> args{filepath};
+         application app{args};
+
+         CHECK_FALSE(std::filesystem::exists(output_derivation));
+      }
+      {
+         std::vector<std::string_view> args{"--trace-derivations", filepath};
+         application app{args};
+
+         CHECK(std::filesystem::exists(output_derivation));
+      }
+   }
 }
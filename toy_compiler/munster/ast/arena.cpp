@@ -0,0 +1,35 @@
+#include <toy_compiler/munster/ast/arena.hpp>
+
+#include <toy_compiler/munster/utility.hpp>
+
+namespace munster::ast
+{
+   /**
+    * @brief Size of the first block of memory of an arena, following blocks grow geometrically
+    */
+   constexpr std::size_t initial_block_size = 64_kb;
+
+   namespace detail
+   {
+      thread_local std::pmr::memory_resource* p_current_resource = nullptr; // NOLINT
+
+      auto current_resource() noexcept -> std::pmr::memory_resource*
+      {
+         if (p_current_resource)
+         {
+            return p_current_resource;
+         }
+
+         return std::pmr::get_default_resource();
+      }
+
+      resource_scope::resource_scope(std::pmr::memory_resource* p_resource) noexcept :
+         mp_previous{std::exchange(p_current_resource, p_resource)}
+      {}
+      resource_scope::~resource_scope() { p_current_resource = mp_previous; }
+   } // namespace detail
+
+   arena::arena() : m_resource{initial_block_size} {}
+
+   auto arena::resource() noexcept -> std::pmr::memory_resource* { return &m_resource; }
+} // namespace munster::ast
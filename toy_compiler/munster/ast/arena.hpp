@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace munster::ast
+{
+   /**
+    * @brief Deleter of the nodes allocated in an `ast::arena`. The nodes, their children & their
+    * lexemes are all released at once with the arena, so deleting a single node does nothing
+    */
+   struct node_deleter
+   {
+      template <typename Node>
+      constexpr void operator()(const Node* /* p_node */) const noexcept
+      {}
+   };
+
+   /**
+    * @brief An owning pointer to a node allocated in an `ast::arena`
+    */
+   template <typename Node>
+   using arena_ptr = std::unique_ptr<Node, node_deleter>;
+
+   namespace detail
+   {
+      /**
+       * @brief The memory resource used by the containers of the nodes under construction. Falls
+       * back to the default resource when no node is being constructed by an `ast::arena`
+       */
+      auto current_resource() noexcept -> std::pmr::memory_resource*;
+
+      /**
+       * @brief Make a memory resource the `detail::current_resource` of the thread for the
+       * lifetime of the object
+       */
+      class resource_scope
+      {
+      public:
+         explicit resource_scope(std::pmr::memory_resource* p_resource) noexcept;
+         resource_scope(const resource_scope&) = delete;
+         resource_scope(resource_scope&&) = delete;
+         ~resource_scope();
+
+         auto operator=(const resource_scope&) -> resource_scope& = delete;
+         auto operator=(resource_scope&&) -> resource_scope& = delete;
+
+      private:
+         std::pmr::memory_resource* mp_previous;
+      };
+   } // namespace detail
+
+   /**
+    * @brief A bump allocator owning the nodes of an AST.
+    *
+    * Nodes, their list of children & their lexemes are carved out of large blocks of memory that
+    * are only given back when the arena is destroyed. Destroying an AST is thus a single release
+    * of the arena instead of a walk over the whole tree. The arena must outlive every node it
+    * made.
+    */
+   class arena
+   {
+   public:
+      arena();
+      arena(const arena&) = delete;
+      arena(arena&&) = delete;
+      ~arena() = default;
+
+      auto operator=(const arena&) -> arena& = delete;
+      auto operator=(arena&&) -> arena& = delete;
+
+      /**
+       * @brief Construct a node in the arena. Every container of the node allocates from the arena
+       * as well
+       */
+      template <typename Node, typename... Args>
+      auto make(Args&&... args) -> arena_ptr<Node>
+      {
+         const detail::resource_scope scope{&m_resource};
+
+         void* p_memory = m_resource.allocate(sizeof(Node), alignof(Node));
+
+         return arena_ptr<Node>{::new (p_memory) Node(std::forward<Args>(args)...)};
+      }
+
+      /**
+       * @brief Access the memory resource of the arena
+       */
+      [[nodiscard]] auto resource() noexcept -> std::pmr::memory_resource*;
+
+   private:
+      std::pmr::monotonic_buffer_resource m_resource;
+   };
+} // namespace munster::ast
@@ -0,0 +1,106 @@
+/**
+ * @brief Runs tests on functions defined in arena.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ast/arena.hpp>
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief A node like type whose containers pick up the memory resource of the arena building it
+ */
+struct test_node
+{
+   test_node(std::string_view name, int value) :
+      m_name{name, munster::ast::detail::current_resource()},
+      m_value{value}
+   {}
+
+   std::pmr::string m_name;                                                  // NOLINT
+   std::pmr::vector<int> m_values{munster::ast::detail::current_resource()}; // NOLINT
+   int m_value;                                                              // NOLINT
+};
+
+TEST_SUITE("Arena test suite")
+{
+   TEST_CASE("make")
+   {
+      munster::ast::arena arena;
+
+      SUBCASE("constructs the node")
+      {
+         const auto node = arena.make<test_node>("a rather long name for a node", 42);
+
+         REQUIRE(node);
+         CHECK(node->m_name == "a rather long name for a node");
+         CHECK(node->m_value == 42);
+      }
+      SUBCASE("containers of the node allocate from the arena")
+      {
+         const auto node = arena.make<test_node>("a rather long name for a node", 42);
+
+         CHECK(node->m_name.get_allocator().resource() == arena.resource());
+         CHECK(node->m_values.get_allocator().resource() == arena.resource());
+      }
+      SUBCASE("the current resource is restored after construction")
+      {
+         const auto node = arena.make<test_node>("name", 0);
+
+         CHECK(munster::ast::detail::current_resource() == std::pmr::get_default_resource());
+
+         const std::pmr::string lexeme{"outside of the arena"};
+         CHECK(lexeme.get_allocator().resource() == std::pmr::get_default_resource());
+      }
+      SUBCASE("nodes keep their values while others are made")
+      {
+         std::vector<munster::ast::arena_ptr<test_node>> nodes;
+         for (int i = 0; i < 1024; ++i) // NOLINT
+         {
+            nodes.push_back(arena.make<test_node>(std::to_string(i), i));
+         }
+
+         for (int i = 0; i < 1024; ++i) // NOLINT
+         {
+            CHECK(std::string_view{nodes[i]->m_name} == std::to_string(i));
+            CHECK(nodes[i]->m_value == i);
+         }
+      }
+   }
+   TEST_CASE("resource_scope")
+   {
+      std::pmr::monotonic_buffer_resource outer;
+      std::pmr::monotonic_buffer_resource inner;
+
+      {
+         const munster::ast::detail::resource_scope outer_scope{&outer};
+         CHECK(munster::ast::detail::current_resource() == &outer);
+
+         {
+            const munster::ast::detail::resource_scope inner_scope{&inner};
+            CHECK(munster::ast::detail::current_resource() == &inner);
+         }
+
+         CHECK(munster::ast::detail::current_resource() == &outer);
+      }
+
+      CHECK(munster::ast::detail::current_resource() == std::pmr::get_default_resource());
+   }
+}
@@ -3,12 +3,12 @@
 namespace munster::ast
 {
    array_index_access_decl::array_index_access_decl(node_ptr beg, node_ptr expr, node_ptr end) :
-      decl{beg->location()},
+      decl{static_kind, beg->location()},
       m_end{end->location()}
    {
       /*
-      assert(dynamic_cast<location_decl*>(beg.get())); // NOLINT
-      assert(dynamic_cast<location_decl*>(end.get())); // NOLINT
+      assert(isa<location_decl>(beg)); // NOLINT
+      assert(isa<location_decl>(end)); // NOLINT
       */
 
       make_child(std::move(expr));
@@ -21,7 +21,8 @@ namespace munster::ast
    }
 
    compound_array_index_access_decl::compound_array_index_access_decl(
-      std::vector<node_ptr>&& variables)
+      std::vector<node_ptr>&& variables) :
+      decl{static_kind}
    {
       make_family<array_index_access_decl>(std::move(variables));
    }
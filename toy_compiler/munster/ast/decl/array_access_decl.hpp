@@ -9,6 +9,8 @@ namespace munster::ast
    class array_index_access_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_array_index_access_decl;
+
       array_index_access_decl(node_ptr beg, node_ptr expr, node_ptr end);
 
       [[nodiscard]] auto to_string() const -> std::string override;
@@ -20,6 +22,8 @@ namespace munster::ast
    class compound_array_index_access_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_compound_array_index_access_decl;
+
       /**
        * @brief Construct a **Compound Node** from a list of node_ptr.
        *
@@ -15,7 +15,7 @@ namespace munster::ast
    }
 
    array_decl::array_decl(node_ptr start_loc, node_ptr integer_lit, node_ptr end_loc) :
-      decl{get_lexeme(integer_lit), start_loc->location()},
+      decl{static_kind, get_lexeme(integer_lit), start_loc->location()},
       m_end_loc{end_loc->location()}
    {}
 
@@ -25,22 +25,24 @@ namespace munster::ast
                          location().column, m_end_loc.line, m_end_loc.column, lexeme());
    }
 
-   void array_decl::accept(visitor_variant& visitor) const { visit_node(visitor, *this); }
+   auto array_decl::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
 
-   compound_array_decl::compound_array_decl(std::vector<node_ptr>&& array_decls)
+   void array_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
+   compound_array_decl::compound_array_decl(std::vector<node_ptr>&& array_decls) : decl{static_kind}
    {
       make_family<array_decl>(std::move(array_decls));
    }
 
    auto compound_array_decl::to_string() const -> std::string { return "compound_array_decl"; }
 
-   void compound_array_decl::accept(visitor_variant& visitor) const
+   auto compound_array_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
+
+   void compound_array_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
 } // namespace munster::ast
@@ -7,9 +7,12 @@ namespace munster::ast
    class array_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_array_decl;
+
       array_decl(node_ptr start_loc, node_ptr integer_lit, node_ptr end_loc);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
 
@@ -20,9 +23,12 @@ namespace munster::ast
    class compound_array_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_compound_array_decl;
+
       compound_array_decl(std::vector<node_ptr>&& member_decl);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -6,13 +6,13 @@ namespace munster::ast
 {
    class_decl::class_decl(node_ptr class_start, node_ptr class_name, node_ptr compound_inheritance,
                           node_ptr compound_member) :
-      decl{class_name->to_string(), class_start->location()}
+      decl{static_kind, class_name->to_string(), class_start->location()}
    {
       /*
-      assert(dynamic_cast<location_decl*>(class_start.get()));                      // NOLINT
-      assert(dynamic_cast<id_decl*>(class_name.get()));                             // NOLINT
-      assert(dynamic_cast<compound_inheritance_decl*>(compound_inheritance.get())); // NOLINT
-      assert(dynamic_cast<compound_member_decl*>(compound_member.get()));           // NOLINT
+      assert(isa<location_decl>(class_start));                      // NOLINT
+      assert(isa<id_decl>(class_name));                             // NOLINT
+      assert(isa<compound_inheritance_decl>(compound_inheritance)); // NOLINT
+      assert(isa<compound_member_decl>(compound_member));           // NOLINT
       */
 
       if (!std::empty(compound_inheritance->children()))
@@ -32,30 +32,25 @@ namespace munster::ast
                          location().column, lexeme());
    }
 
-   void class_decl::accept(visitor_variant& visitor) const
+   auto class_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
-   compound_class_decl::compound_class_decl(std::vector<class_decl::ptr>&& class_decls)
+   void class_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
+   compound_class_decl::compound_class_decl(std::vector<class_decl::ptr>&& class_decls) :
+      decl{static_kind}
    {
       make_family_e<class_decl>(std::move(class_decls));
    };
 
-   void compound_class_decl::accept(visitor_variant& visitor) const
+   auto compound_class_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void compound_class_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto compound_class_decl::to_string() const -> std::string { return "compound_class_decl"; }
 } // namespace munster::ast
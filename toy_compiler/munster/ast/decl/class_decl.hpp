@@ -7,13 +7,15 @@ namespace munster::ast
    class class_decl : public decl
    {
    public:
-      using ptr = std::unique_ptr<class_decl>;
+      using ptr = arena_ptr<class_decl>;
+      static constexpr node_kind static_kind = node_kind::e_class_decl;
 
    public:
       class_decl(node_ptr class_start, node_ptr class_name, node_ptr compound_inheritance,
                  node_ptr compound_member);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -21,12 +23,14 @@ namespace munster::ast
    class compound_class_decl : public decl
    {
    public:
-      using ptr = std::unique_ptr<compound_class_decl>;
+      using ptr = arena_ptr<compound_class_decl>;
+      static constexpr node_kind static_kind = node_kind::e_compound_class_decl;
 
    public:
       compound_class_decl(std::vector<class_decl::ptr>&& class_decls);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -7,20 +7,18 @@
 
 namespace munster::ast
 {
-   compound_member_decl::compound_member_decl(std::vector<node_ptr>&& member_decls)
+   compound_member_decl::compound_member_decl(std::vector<node_ptr>&& member_decls) :
+      decl{static_kind}
    {
       make_family<member_func_decl, member_var_decl>(std::move(member_decls));
    }
 
-   void compound_member_decl::accept(visitor_variant& visitor) const
+   auto compound_member_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void compound_member_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto compound_member_decl::to_string() const -> std::string { return "compound_member_decl"; }
 } // namespace munster::ast
@@ -7,9 +7,12 @@ namespace munster::ast
    class compound_member_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_compound_member_decl;
+
       compound_member_decl(std::vector<node_ptr>&& member_decl);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -6,20 +6,18 @@
 
 namespace munster::ast
 {
-   compound_params_decl::compound_params_decl(std::vector<node_ptr>&& param_decls)
+   compound_params_decl::compound_params_decl(std::vector<node_ptr>&& param_decls) :
+      decl{static_kind}
    {
       make_family<variable_decl>(std::move(param_decls));
    }
 
-   void compound_params_decl::accept(visitor_variant& visitor) const
+   auto compound_params_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void compound_params_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto compound_params_decl::to_string() const -> std::string { return "compound_param_decl"; }
 } // namespace munster::ast
@@ -2,11 +2,18 @@
 
 namespace munster::ast
 {
-   decl::decl(const source_location& location) : node{location} {}
-   decl::decl(const std::string& lexeme, const source_location& location) : node{lexeme, location}
+   decl::decl(node_kind kind) : node{kind} {}
+   decl::decl(node_kind kind, const source_location& location) : node{kind, location} {}
+   decl::decl(node_kind kind, std::string_view lexeme, const source_location& location) :
+      node{kind, lexeme, location}
    {}
 
-   void decl::accept(visitor_variant&) const
+   auto decl::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void decl::leave(visitor_group /*visitors*/) const
    {
       assert(false && "Accept not implemented"); // NOLINT
    }
@@ -7,11 +7,16 @@ namespace munster::ast
    class decl : public node
    {
    public:
-      decl() = default;
-      decl(const source_location& location);
-      decl(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind first_kind = node_kind::e_array_index_access_decl;
+      static constexpr node_kind last_kind = node_kind::e_var_expr;
 
-      void accept(visitor_variant& visitor) const override;
+   public:
+      decl(node_kind kind);
+      decl(node_kind kind, const source_location& location);
+      decl(node_kind kind, std::string_view lexeme, const source_location& location);
+
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override = 0;
    };
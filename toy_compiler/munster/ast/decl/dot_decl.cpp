@@ -2,8 +2,8 @@
 
 namespace munster::ast
 {
-   dot_decl::dot_decl(const std::string& lexeme, const source_location& location) :
-      decl{lexeme, location}
+   dot_decl::dot_decl(std::string_view lexeme, const source_location& location) :
+      decl{static_kind, lexeme, location}
    {}
 
    auto dot_decl::to_string() const -> std::string { return "dot_decl"; }
@@ -7,7 +7,9 @@ namespace munster::ast
    class dot_decl : public decl
    {
    public:
-      dot_decl(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind static_kind = node_kind::e_dot_decl;
+
+      dot_decl(std::string_view lexeme, const source_location& location);
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
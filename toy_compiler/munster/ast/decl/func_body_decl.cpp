@@ -4,7 +4,7 @@
 
 namespace munster::ast
 {
-   func_body_decl::func_body_decl(node_ptr variables, node_ptr statements)
+   func_body_decl::func_body_decl(node_ptr variables, node_ptr statements) : decl{static_kind}
    {
       if (!std::empty(variables->children()))
       {
@@ -17,15 +17,12 @@ namespace munster::ast
       }
    }
 
-   void func_body_decl::accept(visitor_variant& visitor) const
+   auto func_body_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void func_body_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto func_body_decl::to_string() const -> std::string { return "func_body_decl"; }
 } // namespace munster::ast
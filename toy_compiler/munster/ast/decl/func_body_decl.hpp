@@ -7,12 +7,14 @@ namespace munster::ast
    class func_body_decl : public decl
    {
    public:
-      using ptr = std::unique_ptr<func_body_decl>;
+      using ptr = arena_ptr<func_body_decl>;
+      static constexpr node_kind static_kind = node_kind::e_func_body_decl;
 
    public:
       func_body_decl(node_ptr variables, node_ptr statements);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
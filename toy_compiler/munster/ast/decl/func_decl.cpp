@@ -7,39 +7,36 @@
 
 namespace munster::ast
 {
-   func_decl::func_decl(node_ptr function_head, node_ptr function_body)
+   func_decl::func_decl(node_ptr function_head, node_ptr function_body) : decl{static_kind}
    {
-      assert(dynamic_cast<func_head_decl*>(function_head.get())); // NOLINT
-      assert(dynamic_cast<func_body_decl*>(function_body.get())); // NOLINT
+      assert(isa<func_head_decl>(function_head)); // NOLINT
+      assert(isa<func_body_decl>(function_body)); // NOLINT
 
       make_child(std::move(function_head));
       make_child(std::move(function_body));
    }
 
-   void func_decl::accept(visitor_variant& visitor) const
+   auto func_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void func_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto func_decl::to_string() const -> std::string { return "func_decl"; }
 
-   compound_func_decl::compound_func_decl(std::vector<func_decl::ptr>&& func_decls)
+   compound_func_decl::compound_func_decl(std::vector<func_decl::ptr>&& func_decls) :
+      decl{static_kind}
    {
       make_family_e(std::move(func_decls));
    }
 
-   void compound_func_decl::accept(visitor_variant& visitor) const
+   auto compound_func_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
+      return traversal_action::e_continue;
    }
 
+   void compound_func_decl::leave(visitor_group /*visitors*/) const {}
+
    auto compound_func_decl::to_string() const -> std::string { return "compound_func_decl"; }
 } // namespace munster::ast
@@ -7,12 +7,14 @@ namespace munster::ast
    class func_decl : public decl
    {
    public:
-      using ptr = std::unique_ptr<func_decl>;
+      using ptr = arena_ptr<func_decl>;
+      static constexpr node_kind static_kind = node_kind::e_func_decl;
 
    public:
       func_decl(node_ptr function_head, node_ptr statements);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -20,9 +22,12 @@ namespace munster::ast
    class compound_func_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_compound_func_decl;
+
       compound_func_decl(std::vector<func_decl::ptr>&& class_decls);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -9,14 +9,14 @@ namespace munster::ast
 {
    func_head_decl::func_head_decl(node_ptr location, node_ptr id, node_ptr class_method,
                                   node_ptr func_param, node_ptr return_type) :
-      decl{std::string{id->lexeme()}, location->location()},
-      m_return_type{return_type->lexeme()}
+      decl{static_kind, id->lexeme(), location->location()},
+      m_return_type{return_type->lexeme(), detail::current_resource()}
    {
       if (!std::empty(func_param->children()))
       {
          for (const node_ptr& node : func_param->children())
          {
-            const auto* var = dynamic_cast<variable_decl*>(node.get());
+            const auto* var = cast<variable_decl>(node);
 
             if (std::empty(var->children()))
             {
@@ -31,7 +31,7 @@ namespace munster::ast
                std::string type{var->type()};
                for (const auto& test : vars->children())
                {
-                  const auto* var = dynamic_cast<array_decl*>(test.get());
+                  const auto* var = cast<array_decl>(test);
                   type += fmt::format("[{}]", var->lexeme());
                }
 
@@ -44,20 +44,19 @@ namespace munster::ast
 
       if (class_method)
       {
-         m_class = std::string{class_method->lexeme()};
+         m_class.emplace(class_method->lexeme(), detail::current_resource());
       }
+
+      m_signature = intern_signature(class_name().value_or(lexeme()), m_return_type, m_params);
    }
 
-   void func_head_decl::accept(visitor_variant& visitor) const
+   auto func_head_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void func_head_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto func_head_decl::class_name() const -> std::optional<std::string_view>
    {
       if (m_class)
@@ -68,7 +67,11 @@ namespace munster::ast
       return std::nullopt;
    }
    auto func_head_decl::return_type() const -> std::string_view { return m_return_type; }
-   auto func_head_decl::params() const -> std::span<const std::string> { return m_params; }
+   auto func_head_decl::params() const -> std::span<const std::pmr::string>
+   {
+      return m_params;
+   }
+   auto func_head_decl::signature() const -> signature_id { return m_signature; }
    auto func_head_decl::to_string() const -> std::string
    {
       std::string params = "";
@@ -1,25 +1,35 @@
 #pragma once
 
 #include <toy_compiler/munster/ast/decl/decl.hpp>
+#include <toy_compiler/munster/signature.hpp>
 
 namespace munster::ast
 {
    class func_head_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_func_head_decl;
+
       func_head_decl(node_ptr location, node_ptr id, node_ptr class_method, node_ptr function_param,
                      node_ptr return_type);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto class_name() const -> std::optional<std::string_view>;
       [[nodiscard]] auto return_type() const -> std::string_view;
-      [[nodiscard]] auto params() const -> std::span<const std::string>;
+      [[nodiscard]] auto params() const -> std::span<const std::pmr::string>;
+      /**
+       * @brief The signature of the function in the symbol tables, where the name is the one of
+       * the member function when defining a member function
+       */
+      [[nodiscard]] auto signature() const -> signature_id;
       [[nodiscard]] auto to_string() const -> std::string override;
 
    private:
-      std::string m_return_type;
-      std::optional<std::string> m_class;
-      std::vector<std::string> m_params;
+      std::pmr::string m_return_type{detail::current_resource()};
+      std::optional<std::pmr::string> m_class;
+      std::pmr::vector<std::pmr::string> m_params{detail::current_resource()};
+      signature_id m_signature{};
    };
 } // namespace munster::ast
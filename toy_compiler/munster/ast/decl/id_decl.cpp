@@ -2,8 +2,8 @@
 
 namespace munster::ast
 {
-   id_decl::id_decl(const std::string& lexeme, const source_location& location) :
-      decl{lexeme, location}
+   id_decl::id_decl(std::string_view lexeme, const source_location& location) :
+      decl{static_kind, lexeme, location}
    {}
 
    auto id_decl::to_string() const -> std::string { return fmt::format("{}", lexeme()); }
@@ -7,10 +7,11 @@ namespace munster::ast
    class id_decl : public decl
    {
    public:
-      using ptr = std::unique_ptr<id_decl>;
+      using ptr = arena_ptr<id_decl>;
+      static constexpr node_kind static_kind = node_kind::e_id_decl;
 
    public:
-      id_decl(const std::string& lexeme, const source_location& location);
+      id_decl(std::string_view lexeme, const source_location& location);
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
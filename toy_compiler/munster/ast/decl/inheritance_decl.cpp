@@ -4,11 +4,16 @@
 
 namespace munster::ast
 {
-   inheritance_decl::inheritance_decl(const std::string& name, const source_location& location) :
-      decl{name, location}
+   inheritance_decl::inheritance_decl(std::string_view name, const source_location& location) :
+      decl{static_kind, name, location}
    {}
 
-   void inheritance_decl::accept(visitor_variant& visitor) const { visit_node(visitor, *this); }
+   auto inheritance_decl::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void inheritance_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
 
    auto inheritance_decl::to_string() const -> std::string
    {
@@ -16,19 +21,20 @@ namespace munster::ast
                          location().column, lexeme());
    }
 
-   compound_inheritance_decl::compound_inheritance_decl(std::vector<node_ptr>&& inheritance_decls)
+   compound_inheritance_decl::compound_inheritance_decl(std::vector<node_ptr>&& inheritance_decls) :
+      decl{static_kind}
    {
       make_family<inheritance_decl>(std::move(inheritance_decls));
    }
 
-   void compound_inheritance_decl::accept(visitor_variant& visitor) const
+   auto compound_inheritance_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
+      return traversal_action::e_continue;
+   }
 
-      visit_node(visitor, *this);
+   void compound_inheritance_decl::leave(visitor_group visitors) const
+   {
+      visit_node(visitors, *this);
    }
 
    auto compound_inheritance_decl::to_string() const -> std::string
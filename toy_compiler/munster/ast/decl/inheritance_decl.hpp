@@ -7,9 +7,12 @@ namespace munster::ast
    class inheritance_decl : public decl
    {
    public:
-      inheritance_decl(const std::string& name, const source_location& location);
+      static constexpr node_kind static_kind = node_kind::e_inheritance_decl;
 
-      void accept(visitor_variant& visitor) const override;
+      inheritance_decl(std::string_view name, const source_location& location);
+
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -17,9 +20,12 @@ namespace munster::ast
    class compound_inheritance_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_compound_inheritance_decl;
+
       compound_inheritance_decl(std::vector<node_ptr>&& class_decls);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -2,7 +2,7 @@
 
 namespace munster::ast
 {
-   location_decl::location_decl(const source_location& location) : decl{location} {}
+   location_decl::location_decl(const source_location& location) : decl{static_kind, location} {}
 
    auto location_decl::to_string() const -> std::string { return fmt::format("{}", location()); }
 } // namespace munster::ast
@@ -7,7 +7,8 @@ namespace munster::ast
    class location_decl : public decl
    {
    public:
-      using ptr = std::unique_ptr<location_decl>;
+      using ptr = arena_ptr<location_decl>;
+      static constexpr node_kind static_kind = node_kind::e_location_decl;
 
    public:
       location_decl(const source_location& location);
@@ -5,21 +5,18 @@
 namespace munster::ast
 {
    main_decl::main_decl(id_decl::ptr id, func_body_decl::ptr func_body) :
-      decl{std::string{id->lexeme()}, id->location()}
+      decl{static_kind, std::string{id->lexeme()}, id->location()}
    {
       make_child(std::move(func_body));
    }
 
-   void main_decl::accept(visitor_variant& visitor) const
+   auto main_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void main_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto main_decl::to_string() const -> std::string
    {
       return fmt::format("main_decl <line:{}, col:{}> {}", location().line, location().column,
@@ -10,9 +10,12 @@ namespace munster::ast
    class main_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_main_decl;
+
       main_decl(id_decl::ptr id, func_body_decl::ptr func_body);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
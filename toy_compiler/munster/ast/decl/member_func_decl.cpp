@@ -9,8 +9,8 @@ namespace munster::ast
 {
    member_func_decl::member_func_decl(node_ptr visibility, node_ptr location, node_ptr id,
                                       node_ptr compound_param, node_ptr tail) :
-      decl{std::string{id->lexeme()}, location->location()},
-      m_return_type{tail->lexeme()}
+      decl{static_kind, id->lexeme(), location->location()},
+      m_return_type{tail->lexeme(), detail::current_resource()}
    {
       if (visibility)
       {
@@ -21,7 +21,7 @@ namespace munster::ast
       {
          for (const node_ptr& node : compound_param->children())
          {
-            const auto* var = dynamic_cast<variable_decl*>(node.get());
+            const auto* var = cast<variable_decl>(node);
 
             if (std::empty(var->children()))
             {
@@ -36,7 +36,7 @@ namespace munster::ast
                std::string type{var->type()};
                for (const auto& test : vars->children())
                {
-                  const auto* var = dynamic_cast<array_decl*>(test.get());
+                  const auto* var = cast<array_decl>(test);
                   type += fmt::format("[{}]", var->lexeme());
                }
 
@@ -46,12 +46,17 @@ namespace munster::ast
 
          make_child(std::move(compound_param));
       }
+
+      m_signature = intern_signature(lexeme(), m_return_type, m_params);
    }
 
    auto member_func_decl::visibility() const -> std::string_view { return m_visibility; }
 
    auto member_func_decl::return_type() const -> std::string_view { return m_return_type; }
-   auto member_func_decl::params() const -> std::span<const std::string> { return m_params; }
+   auto member_func_decl::params() const -> std::span<const std::pmr::string>
+   {
+      return m_params;
+   }
 
    auto member_func_decl::params_string() const -> std::string
    {
@@ -64,11 +69,17 @@ namespace munster::ast
 
       return params.substr(0, std::size(params) - 2);
    }
+   auto member_func_decl::signature() const -> signature_id { return m_signature; }
    auto member_func_decl::to_string() const -> std::string
    {
       return fmt::format("member_func_decl {} {} '{} {} ({})'", location(), lexeme(), visibility(),
                          m_return_type, params_string());
    }
 
-   void member_func_decl::accept(visitor_variant& visitor) const { visit_node(visitor, *this); }
+   auto member_func_decl::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void member_func_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
 } // namespace munster::ast
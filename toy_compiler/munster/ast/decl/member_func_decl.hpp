@@ -1,27 +1,36 @@
 #pragma once
 
 #include <toy_compiler/munster/ast/decl/decl.hpp>
+#include <toy_compiler/munster/signature.hpp>
 
 namespace munster::ast
 {
    class member_func_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_member_func_decl;
+
       member_func_decl(node_ptr visibility, node_ptr location, node_ptr id,
                        node_ptr compound_params, node_ptr tail);
 
       [[nodiscard]] auto visibility() const -> std::string_view;
       [[nodiscard]] auto return_type() const -> std::string_view;
-      [[nodiscard]] auto params() const -> std::span<const std::string>;
+      [[nodiscard]] auto params() const -> std::span<const std::pmr::string>;
 
       [[nodiscard]] auto params_string() const -> std::string;
+      /**
+       * @brief The signature of the function in the symbol table of its class
+       */
+      [[nodiscard]] auto signature() const -> signature_id;
       [[nodiscard]] auto to_string() const -> std::string override;
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
    private:
-      std::string m_visibility;
-      std::string m_return_type;
-      std::vector<std::string> m_params;
+      std::pmr::string m_visibility{detail::current_resource()};
+      std::pmr::string m_return_type{detail::current_resource()};
+      std::pmr::vector<std::pmr::string> m_params{detail::current_resource()};
+      signature_id m_signature{};
    };
 } // namespace munster::ast
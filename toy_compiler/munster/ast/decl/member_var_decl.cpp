@@ -6,12 +6,12 @@ namespace munster::ast
 {
    member_var_decl::member_var_decl(node_ptr visibility, node_ptr type, node_ptr id,
                                     node_ptr compound_array) :
-      decl{std::string{id->lexeme()}, type->location()},
-      m_type{type->lexeme()}
+      decl{static_kind, id->lexeme(), type->location()},
+      m_type{type->lexeme(), detail::current_resource()}
    {
       if (visibility)
       {
-         m_visibility = std::string{visibility->lexeme()};
+         m_visibility = visibility->lexeme();
       }
 
       if (!std::empty(compound_array->children()))
@@ -29,13 +29,10 @@ namespace munster::ast
                          type());
    }
 
-   void member_var_decl::accept(visitor_variant& visitor) const
+   auto member_var_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
+
+   void member_var_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
 } // namespace munster::ast
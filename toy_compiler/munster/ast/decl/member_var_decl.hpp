@@ -7,6 +7,8 @@ namespace munster::ast
    class member_var_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_member_var_decl;
+
       member_var_decl(node_ptr visibility, node_ptr type, node_ptr id, node_ptr compound_array);
 
       [[nodiscard]] auto visibility() const -> std::string_view;
@@ -14,10 +16,11 @@ namespace munster::ast
 
       [[nodiscard]] auto to_string() const -> std::string override;
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
    private:
-      std::string m_visibility = "private";
-      std::string m_type;
+      std::pmr::string m_visibility{"private", detail::current_resource()};
+      std::pmr::string m_type{detail::current_resource()};
    };
 } // namespace munster::ast
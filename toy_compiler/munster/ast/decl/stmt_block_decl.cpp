@@ -2,11 +2,9 @@
 
 #include <toy_compiler/munster/ast/utility.hpp>
 
-using namespace mpark::patterns;
-
 namespace munster::ast
 {
-   stmt_block_decl::stmt_block_decl(node_ptr node)
+   stmt_block_decl::stmt_block_decl(node_ptr node) : decl{static_kind}
    {
       if (node)
       {
@@ -14,22 +12,20 @@ namespace munster::ast
       }
    }
 
-   void stmt_block_decl::accept(visitor_variant& visitor) const
+   auto stmt_block_decl::enter(visitor_group visitors) const -> traversal_action
    {
-      match(visitor)(
-         pattern(as<code_gen_visitor>(arg)) =
-            [](code_gen_visitor& vis) {
-               vis.place_marker("stmt_block");
-            },
-         pattern(_) = [] {});
-
-      for (const auto& child : children())
+      for (auto& visitor : visitors)
       {
-         child->accept(visitor);
+         if (auto* p_code_gen = std::get_if<code_gen_visitor>(&visitor))
+         {
+            p_code_gen->begin_stmt_block();
+         }
       }
 
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void stmt_block_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto stmt_block_decl::to_string() const -> std::string { return "stmt_block_decl"; }
 } // namespace munster::ast
@@ -7,12 +7,14 @@ namespace munster::ast
    class stmt_block_decl : public decl
    {
    public:
-      using ptr = std::unique_ptr<stmt_block_decl>;
+      using ptr = arena_ptr<stmt_block_decl>;
+      static constexpr node_kind static_kind = node_kind::e_stmt_block_decl;
 
    public:
       stmt_block_decl(node_ptr node);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
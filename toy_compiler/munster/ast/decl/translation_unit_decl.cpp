@@ -5,12 +5,13 @@
 namespace munster::ast
 {
    translation_unit_decl::translation_unit_decl(compound_class_decl::ptr compound_class,
-                                                node_ptr compound_function, node_ptr main)
+                                                node_ptr compound_function, node_ptr main) :
+      decl{static_kind}
    {
       /*
-      assert(dynamic_cast<compound_class_decl*>(compound_class.get()));   // NOLINT
-      assert(dynamic_cast<compound_func_decl*>(compound_function.get())); // NOLINT
-      assert(dynamic_cast<main_decl*>(main.get()));                       // NOLINT
+      assert(isa<compound_class_decl>(compound_class));   // NOLINT
+      assert(isa<compound_func_decl>(compound_function)); // NOLINT
+      assert(isa<main_decl>(main));                       // NOLINT
       */
 
       make_child(std::move(compound_class));
@@ -18,15 +19,12 @@ namespace munster::ast
       make_child(std::move(main));
    }
 
-   void translation_unit_decl::accept(visitor_variant& visitor) const
+   auto translation_unit_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void translation_unit_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto translation_unit_decl::to_string() const -> std::string { return "translation_unit_decl"; }
 } // namespace munster::ast
@@ -7,18 +7,21 @@
 namespace munster::ast
 {
    /*
-   assert(dynamic_cast<compound_class_decl*>(compound_class.get()));   // NOLINT
-   assert(dynamic_cast<compound_func_decl*>(compound_function.get())); // NOLINT
-   assert(dynamic_cast<main_decl*>(main.get()));                       // NOLINT
+   assert(isa<compound_class_decl>(compound_class));   // NOLINT
+   assert(isa<compound_func_decl>(compound_function)); // NOLINT
+   assert(isa<main_decl>(main));                       // NOLINT
    */
 
    class translation_unit_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_translation_unit_decl;
+
       translation_unit_decl(compound_class_decl::ptr compound_class, node_ptr compound_function,
                             node_ptr main);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -2,8 +2,8 @@
 
 namespace munster::ast
 {
-   type_decl::type_decl(const std::string& name, const source_location& location) :
-      decl{name, location}
+   type_decl::type_decl(std::string_view name, const source_location& location) :
+      decl{static_kind, name, location}
    {}
 
    auto type_decl::to_string() const -> std::string { return fmt::format("{}", lexeme()); }
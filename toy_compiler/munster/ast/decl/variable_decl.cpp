@@ -5,8 +5,8 @@
 namespace munster::ast
 {
    variable_decl::variable_decl(node_ptr type, node_ptr id, node_ptr compound_array_decl) :
-      decl{std::string{id->lexeme()}, type->location()},
-      m_type(type->lexeme())
+      decl{static_kind, id->lexeme(), type->location()},
+      m_type{type->lexeme(), detail::current_resource()}
    {
       if (!std::empty(compound_array_decl->children()))
       {
@@ -21,31 +21,26 @@ namespace munster::ast
                          location().column, lexeme(), m_type);
    }
 
-   void variable_decl::accept(visitor_variant& visitor) const
+   auto variable_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
-   compound_variable_decl::compound_variable_decl(std::vector<node_ptr>&& variables)
+   void variable_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
+   compound_variable_decl::compound_variable_decl(std::vector<node_ptr>&& variables) :
+      decl{static_kind}
    {
       make_family<variable_decl>(std::move(variables));
    }
 
-   void compound_variable_decl::accept(visitor_variant& visitor) const
+   auto compound_variable_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void compound_variable_decl::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto compound_variable_decl::to_string() const -> std::string
    {
       return fmt::format("compound_variable_decl");
@@ -7,24 +7,30 @@ namespace munster::ast
    class variable_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_variable_decl;
+
       variable_decl(node_ptr type, node_ptr id, node_ptr compound_array);
 
       [[nodiscard]] auto type() const -> std::string_view;
 
       [[nodiscard]] auto to_string() const -> std::string override;
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
    private:
-      std::string m_type;
+      std::pmr::string m_type{detail::current_resource()};
    };
 
    class compound_variable_decl : public decl
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_compound_variable_decl;
+
       compound_variable_decl(std::vector<node_ptr>&& variables);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
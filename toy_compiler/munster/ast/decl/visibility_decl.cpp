@@ -4,8 +4,8 @@
 
 namespace munster::ast
 {
-   visibility_decl::visibility_decl(const std::string& name, const source_location& location) :
-      decl{name, location}
+   visibility_decl::visibility_decl(std::string_view name, const source_location& location) :
+      decl{static_kind, name, location}
    {}
 
    auto visibility_decl::to_string() const -> std::string
@@ -7,7 +7,9 @@ namespace munster::ast
    class visibility_decl : public decl
    {
    public:
-      visibility_decl(const std::string& name, const source_location& location);
+      static constexpr node_kind static_kind = node_kind::e_visibility_decl;
+
+      visibility_decl(std::string_view name, const source_location& location);
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
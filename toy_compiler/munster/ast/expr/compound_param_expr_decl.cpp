@@ -6,19 +6,19 @@
 
 namespace munster::ast
 {
-   compound_parameter_expr_decl::compound_parameter_expr_decl(std::vector<node_ptr>&& params_decl)
+   compound_parameter_expr_decl::compound_parameter_expr_decl(std::vector<node_ptr>&& params_decl) :
+      decl{static_kind}
    {
       make_family<expr, op>(std::move(params_decl));
    }
 
-   void compound_parameter_expr_decl::accept(visitor_variant& visitor) const
+   auto compound_parameter_expr_decl::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (auto& child : children())
-      {
-         child->accept(visitor);
-      }
+      return traversal_action::e_continue;
    }
 
+   void compound_parameter_expr_decl::leave(visitor_group /*visitors*/) const {}
+
    auto compound_parameter_expr_decl::to_string() const -> std::string
    {
       return fmt::format("compound_parameter_expr_decl");
@@ -7,12 +7,14 @@ namespace munster::ast
    class compound_parameter_expr_decl : public decl
    {
    public:
-      using ptr = std::unique_ptr<compound_parameter_expr_decl>;
+      using ptr = arena_ptr<compound_parameter_expr_decl>;
+      static constexpr node_kind static_kind = node_kind::e_compound_parameter_expr_decl;
 
    public:
       compound_parameter_expr_decl(std::vector<node_ptr>&& member_decl);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
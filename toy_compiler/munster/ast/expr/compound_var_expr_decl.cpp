@@ -4,7 +4,8 @@
 
 namespace munster::ast
 {
-   compound_var_expr_decl::compound_var_expr_decl(std::vector<node_ptr>&& var_exprs)
+   compound_var_expr_decl::compound_var_expr_decl(std::vector<node_ptr>&& var_exprs) :
+      expr{static_kind}
    {
       make_family<var_expr>(std::move(var_exprs));
    }
@@ -7,6 +7,8 @@ namespace munster::ast
    class compound_var_expr_decl : public expr
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_compound_var_expr_decl;
+
       compound_var_expr_decl(std::vector<node_ptr>&& var_exprs);
 
       [[nodiscard]] auto to_string() const -> std::string override;
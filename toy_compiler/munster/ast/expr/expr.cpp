@@ -2,9 +2,16 @@
 
 namespace munster::ast
 {
-   expr::expr(const source_location& location) : decl{location} {}
-   expr::expr(const std::string& lexeme, const source_location& location) : decl{lexeme, location}
+   expr::expr(node_kind kind) : decl{kind} {}
+   expr::expr(node_kind kind, const source_location& location) : decl{kind, location} {}
+   expr::expr(node_kind kind, std::string_view lexeme, const source_location& location) :
+      decl{kind, lexeme, location}
    {}
 
-   void expr::accept(visitor_variant& /*visitor*/) const {}
+   auto expr::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void expr::leave(visitor_group /*visitors*/) const {}
 } // namespace munster::ast
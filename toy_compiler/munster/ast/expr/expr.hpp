@@ -7,11 +7,16 @@ namespace munster::ast
    class expr : public decl
    {
    public:
-      expr() = default;
-      expr(const source_location& location);
-      expr(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind first_kind = node_kind::e_compound_var_expr_decl;
+      static constexpr node_kind last_kind = node_kind::e_var_expr;
 
-      void accept(visitor_variant& visitor) const override;
+   public:
+      expr(node_kind kind);
+      expr(node_kind kind, const source_location& location);
+      expr(node_kind kind, std::string_view lexeme, const source_location& location);
+
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override = 0;
    };
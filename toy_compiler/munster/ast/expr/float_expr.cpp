@@ -4,15 +4,17 @@
 
 namespace munster::ast
 {
-   float_expr::float_expr(const std::string& lexeme, const source_location& location) :
-      expr{lexeme, location}
+   float_expr::float_expr(std::string_view lexeme, const source_location& location) :
+      expr{static_kind, lexeme, location}
    {}
 
-   void float_expr::accept(visitor_variant& visitor) const
+   auto float_expr::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      visit_node(visitor, *this);
+      return traversal_action::e_skip_children;
    }
 
+   void float_expr::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto float_expr::to_string() const -> std::string
    {
       return fmt::format("float_expr <line:{1}, col:{2}> '{0}'", lexeme(), location().line,
@@ -6,7 +6,7 @@ namespace munster::ast
 {
    func_expr::func_expr(id_decl::ptr id,
                         compound_parameter_expr_decl::ptr compound_input_parameter) :
-      expr{std::string{id->lexeme()}, id->location()}
+      expr{static_kind, std::string{id->lexeme()}, id->location()}
    {
       if (!std::empty(compound_input_parameter->children()))
       {
@@ -14,16 +14,13 @@ namespace munster::ast
       }
    }
 
-   void func_expr::accept(visitor_variant& visitor) const
+   auto func_expr::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void func_expr::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto func_expr::to_string() const -> std::string
    {
       return fmt::format("function_expr <line:{1}, col:{2}> '{0}'", lexeme(), location().line,
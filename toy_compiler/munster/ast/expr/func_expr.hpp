@@ -9,9 +9,12 @@ namespace munster::ast
    class func_expr : public expr
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_func_expr;
+
       func_expr(id_decl::ptr id, compound_parameter_expr_decl::ptr compound_input_parameter);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
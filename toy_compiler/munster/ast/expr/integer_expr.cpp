@@ -4,11 +4,16 @@
 
 namespace munster::ast
 {
-   integer_expr::integer_expr(const std::string& lexeme, const source_location& location) :
-      expr{lexeme, location}
+   integer_expr::integer_expr(std::string_view lexeme, const source_location& location) :
+      expr{static_kind, lexeme, location}
    {}
 
-   void integer_expr::accept(visitor_variant& visitor) const { visit_node(visitor, *this); }
+   auto integer_expr::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void integer_expr::leave(visitor_group visitors) const { visit_node(visitors, *this); }
 
    auto integer_expr::to_string() const -> std::string
    {
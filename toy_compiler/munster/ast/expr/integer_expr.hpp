@@ -7,9 +7,12 @@ namespace munster::ast
    class integer_expr : public expr
    {
    public:
-      integer_expr(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind static_kind = node_kind::e_integer_expr;
 
-      void accept(visitor_variant& visitor) const override;
+      integer_expr(std::string_view lexeme, const source_location& location);
+
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
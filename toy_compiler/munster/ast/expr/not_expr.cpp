@@ -8,11 +8,11 @@
 namespace munster::ast
 {
    not_expr::not_expr(node_ptr value, node_ptr factor_in) :
-      expr{std::string{value->lexeme()}, value->location()}
+      expr{static_kind, std::string{value->lexeme()}, value->location()}
    {
-      assert(dynamic_cast<id_decl*>(value.get())); // NOLINT
+      assert(isa<id_decl>(value)); // NOLINT
       // NOLINTNEXTLINE
-      assert(dynamic_cast<expr*>(factor_in.get()) || dynamic_cast<mult_op*>(factor_in.get()));
+      assert((isa<expr, mult_op>(factor_in)));
 
       make_child(std::move(factor_in));
    }
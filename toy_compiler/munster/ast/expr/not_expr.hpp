@@ -7,6 +7,8 @@ namespace munster::ast
    class not_expr : public expr
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_not_expr;
+
       not_expr(node_ptr value, node_ptr factor);
 
       [[nodiscard]] auto to_string() const -> std::string override;
@@ -7,11 +7,12 @@
 
 namespace munster::ast
 {
-   priority_expr::priority_expr(node_ptr location, node_ptr expr_in) : expr{location->location()}
+   priority_expr::priority_expr(node_ptr location, node_ptr expr_in) :
+      expr{static_kind, location->location()}
    {
-      assert(dynamic_cast<location_decl*>(location.get())); // NOLINT
+      assert(isa<location_decl>(location)); // NOLINT
       // NOLINTNEXTLINE
-      assert(dynamic_cast<expr*>(expr_in.get()) || dynamic_cast<op*>(expr_in.get()));
+      assert((isa<expr, op>(expr_in)));
 
       make_child(std::move(expr_in));
    }
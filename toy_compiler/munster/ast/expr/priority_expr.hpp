@@ -7,6 +7,8 @@ namespace munster::ast
    class priority_expr : public expr
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_priority_expr;
+
       priority_expr(node_ptr location, node_ptr expr);
 
       [[nodiscard]] auto to_string() const -> std::string override;
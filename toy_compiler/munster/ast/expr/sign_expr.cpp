@@ -5,7 +5,7 @@
 namespace munster::ast
 {
    sign_expr::sign_expr(node_ptr sign, node_ptr factor_in) :
-      expr{std::string{sign->lexeme()}, sign->location()}
+      expr{static_kind, std::string{sign->lexeme()}, sign->location()}
    {
       make_child(std::move(factor_in));
    }
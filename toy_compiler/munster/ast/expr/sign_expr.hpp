@@ -7,6 +7,8 @@ namespace munster::ast
    class sign_expr : public expr
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_sign_expr;
+
       sign_expr(node_ptr sign, node_ptr factor);
 
       [[nodiscard]] auto to_string() const -> std::string override;
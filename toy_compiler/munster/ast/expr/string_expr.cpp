@@ -4,11 +4,16 @@
 
 namespace munster::ast
 {
-   string_expr::string_expr(const std::string& lexeme, const source_location& location) :
-      expr{lexeme, location}
+   string_expr::string_expr(std::string_view lexeme, const source_location& location) :
+      expr{static_kind, lexeme, location}
    {}
 
-   void string_expr::accept(visitor_variant& visitor) const { visit_node(visitor, *this); }
+   auto string_expr::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void string_expr::leave(visitor_group visitors) const { visit_node(visitors, *this); }
 
    auto string_expr::to_string() const -> std::string
    {
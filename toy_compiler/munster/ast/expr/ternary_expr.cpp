@@ -6,7 +6,7 @@ namespace munster::ast
 {
    ternary_expr::ternary_expr(node_ptr location, node_ptr condition, node_ptr expr_0,
                               node_ptr expr_1) :
-      expr{location->location()}
+      expr{static_kind, location->location()}
    {
       make_child(std::move(condition));
       make_child(std::move(expr_0));
@@ -7,6 +7,8 @@ namespace munster::ast
    class ternary_expr : public expr
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_ternary_expr;
+
       ternary_expr(node_ptr location, node_ptr condition, node_ptr expr_0, node_ptr expr_1);
 
       [[nodiscard]] auto to_string() const -> std::string override;
@@ -5,7 +5,7 @@
 namespace munster::ast
 {
    var_expr::var_expr(node_ptr id, node_ptr compound_array_indices) :
-      expr{std::string{id->lexeme()}, id->location()}
+      expr{static_kind, std::string{id->lexeme()}, id->location()}
    {
       if (!std::empty(compound_array_indices->children()))
       {
@@ -13,7 +13,12 @@ namespace munster::ast
       }
    }
 
-   void var_expr::accept(visitor_variant& visitor) const { visit_node(visitor, *this); }
+   auto var_expr::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void var_expr::leave(visitor_group visitors) const { visit_node(visitors, *this); }
 
    auto var_expr::to_string() const -> std::string
    {
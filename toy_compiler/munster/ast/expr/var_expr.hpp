@@ -7,9 +7,12 @@ namespace munster::ast
    class var_expr : public expr
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_var_expr;
+
       var_expr(node_ptr id, node_ptr compound_array_indices);
       
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -2,8 +2,8 @@
 
 namespace munster::ast
 {
-   integer_literal::integer_literal(const std::string& lexeme, const source_location& location) :
-      literal{lexeme, location}
+   integer_literal::integer_literal(std::string_view lexeme, const source_location& location) :
+      literal{static_kind, lexeme, location}
    {}
 
    auto integer_literal::to_string() const -> std::string
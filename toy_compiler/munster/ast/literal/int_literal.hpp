@@ -7,7 +7,9 @@ namespace munster::ast
    class integer_literal : public literal
    {
    public:
-      integer_literal(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind static_kind = node_kind::e_integer_literal;
+
+      integer_literal(std::string_view lexeme, const source_location& location);
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
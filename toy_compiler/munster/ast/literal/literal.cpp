@@ -6,12 +6,18 @@
 
 namespace munster::ast
 {
-   literal::literal(const source_location& location) : node{location} {}
-   literal::literal(const std::string& lexeme, const source_location& location) :
-      node{lexeme, location}
+   literal::literal(node_kind kind) : node{kind} {}
+   literal::literal(node_kind kind, const source_location& location) : node{kind, location} {}
+   literal::literal(node_kind kind, std::string_view lexeme, const source_location& location) :
+      node{kind, lexeme, location}
    {}
 
-   void literal::accept(visitor_variant& /*visitor*/) const
+   auto literal::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void literal::leave(visitor_group /*visitors*/) const
    {
       assert(false && "Accept not implemented"); // NOLINT
    }
@@ -7,11 +7,16 @@ namespace munster::ast
    class literal : public node
    {
    public:
-      literal() = default;
-      literal(const source_location& location);
-      literal(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind first_kind = node_kind::e_integer_literal;
+      static constexpr node_kind last_kind = node_kind::e_integer_literal;
 
-      void accept(visitor_variant& visitor) const override;
+   public:
+      literal(node_kind kind);
+      literal(node_kind kind, const source_location& location);
+      literal(node_kind kind, std::string_view lexeme, const source_location& location);
+
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override = 0;
    };
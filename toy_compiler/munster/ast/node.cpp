@@ -1,14 +1,23 @@
 #include <toy_compiler/munster/ast/node.hpp>
 
+#include <toy_compiler/munster/ast/traversal.hpp>
+
 namespace munster::ast
 {
-   node::node(const source_location& location) : m_location{location} {}
-   node::node(std::string lexeme, const source_location& location) :
-      m_lexeme{std::move(lexeme)},
-      m_location{location}
+   node::node(node_kind kind) : m_kind{kind} {}
+   node::node(node_kind kind, const source_location& location) :
+      m_location{location},
+      m_kind{kind}
+   {}
+   node::node(node_kind kind, std::string_view lexeme, const source_location& location) :
+      m_lexeme{lexeme, detail::current_resource()},
+      m_location{location},
+      m_lexeme_id{intern(lexeme)},
+      m_kind{kind}
    {}
 
-   auto node::children() const -> const std::vector<node_ptr>& { return m_children; }
+   auto node::kind() const noexcept -> node_kind { return m_kind; }
+   auto node::children() const -> const std::pmr::vector<node_ptr>& { return m_children; }
    auto node::lexeme() const -> std::string_view
    {
       if (!std::empty(m_lexeme))
@@ -18,7 +27,23 @@ namespace munster::ast
 
       return {};
    }
+   auto node::lexeme_id() const noexcept -> string_id { return m_lexeme_id; }
    auto node::location() const -> const source_location& { return m_location; }
 
+   void node::accept(visitor_variant& visitor) const { accept(visitor_group{&visitor, 1}); }
+   void node::accept(visitor_group visitors) const
+   {
+      walk(*this, [=](const node& current, traversal_event event, std::size_t /*depth*/) {
+         if (event == traversal_event::e_enter)
+         {
+            return current.enter(visitors);
+         }
+
+         current.leave(visitors);
+
+         return traversal_action::e_continue;
+      });
+   }
+
    void node::make_child(node_ptr child) { m_children.push_back(std::move(child)); }
 } // namespace munster::ast
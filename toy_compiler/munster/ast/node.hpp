@@ -1,7 +1,10 @@
 #pragma once
 
+#include <toy_compiler/munster/ast/arena.hpp>
+#include <toy_compiler/munster/ast/node_kind.hpp>
 #include <toy_compiler/munster/grammar/actions.hpp>
 #include <toy_compiler/munster/lexer.hpp>
+#include <toy_compiler/munster/string_interner.hpp>
 #include <toy_compiler/munster/visitor/code_gen/code_gen_visitor.hpp>
 #include <toy_compiler/munster/visitor/semantic_checking/type_checking_visitor.hpp>
 #include <toy_compiler/munster/visitor/symbol_table/memory_size_visitor.hpp>
@@ -12,42 +15,116 @@
 
 #include <range/v3/view/move.hpp>
 
+#include <cassert>
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <span>
 #include <variant>
 
 namespace munster::ast
 {
    class node;
 
-   using node_ptr = std::unique_ptr<node>;
+   using node_ptr = arena_ptr<node>;
 
    using visitor_variant = std::variant<type_checking_visitor, symbol_table_visitor,
                                         memory_size_visitor, code_gen_visitor>;
 
+   /**
+    * @brief Visitors that walk the AST together. Every node is visited by each visitor of the
+    * group, in order, during a single traversal of the tree
+    */
+   using visitor_group = std::span<visitor_variant>;
+
+   /**
+    * @brief What a walk of the AST should do after handing a node over to its caller
+    */
+   enum struct traversal_action : std::uint8_t
+   {
+      e_continue,      // walk the children of the node, then the rest of the tree
+      e_skip_children, // walk the rest of the tree, without the children of the node
+      e_stop           // end the walk right away
+   };
+
    namespace detail
    {
-      template <typename... NodeTypes>
-      auto is_type(const node_ptr& n) -> bool
+      /**
+       * @brief Check if a node of the given kind is a `NodeType`. Concrete node types match a
+       * single kind while abstract ones match the range of kinds of their family
+       */
+      template <typename NodeType>
+      constexpr auto is_kind_of(node_kind kind) -> bool
       {
-         return (dynamic_cast<NodeTypes*>(n.get()) || ...);
+         if constexpr (requires { NodeType::static_kind; })
+         {
+            return kind == NodeType::static_kind;
+         }
+         else
+         {
+            return kind >= NodeType::first_kind && kind <= NodeType::last_kind;
+         }
       }
-
    } // namespace detail
 
+   template <typename... NodeTypes>
+   auto isa(const node& n) -> bool;
+   template <typename... NodeTypes>
+   auto isa(const node* p_node) -> bool;
+   template <typename... NodeTypes, typename From>
+   auto isa(const arena_ptr<From>& p_node) -> bool;
+
+   template <typename To>
+   auto cast(node& n) -> To&;
+   template <typename To>
+   auto cast(const node& n) -> const To&;
+   template <typename To>
+   auto cast(node* p_node) -> To*;
+   template <typename To>
+   auto cast(const node* p_node) -> const To*;
    template <typename To, typename From>
-   auto node_cast(std::unique_ptr<From>&& node) -> std::unique_ptr<To>
+   auto cast(const arena_ptr<From>& p_node) -> To*;
+
+   /**
+    * @brief Predicate form of `ast::isa`, usable with the range algorithms
+    */
+   template <typename... NodeTypes>
+   inline constexpr auto isa_pred = [](const auto& n) {
+      return isa<NodeTypes...>(n);
+   };
+   /**
+    * @brief Function object form of `ast::cast`, usable with the range adaptors
+    */
+   template <typename To>
+   inline constexpr auto cast_to = [](const auto& n) {
+      return cast<To>(n);
+   };
+
+   /**
+    * @brief Transfer the ownership of a node to an `ast::arena_ptr<To>`. Gives back a null pointer
+    * if the node is not a `To`
+    */
+   template <typename To, typename From>
+   auto node_cast(arena_ptr<From>&& p_node) -> arena_ptr<To>
    {
-      std::unique_ptr<To> result{dynamic_cast<To*>(node.release())};
+      if (!isa<To>(p_node))
+      {
+         return nullptr;
+      }
 
-      return result;
+      return arena_ptr<To>{static_cast<To*>(p_node.release())};
    }
 
    class node
    {
    public:
-      node() = default;
-      node(const source_location& location);
-      node(std::string lexeme, const source_location& location);
+      static constexpr node_kind first_kind = node_kind::e_array_index_access_decl;
+      static constexpr node_kind last_kind = node_kind::e_write_stmt;
+
+   public:
+      node(node_kind kind);
+      node(node_kind kind, const source_location& location);
+      node(node_kind kind, std::string_view lexeme, const source_location& location);
       node(const node& rhs) = delete;
       node(node&& rhs) = default;
       virtual ~node() = default;
@@ -55,13 +132,38 @@ namespace munster::ast
       auto operator=(const node& rhs) -> node& = delete;
       auto operator=(node&& rhs) -> node& = default;
 
-      [[nodiscard]] auto children() const -> const std::vector<node_ptr>&;
+      [[nodiscard]] auto kind() const noexcept -> node_kind;
+      [[nodiscard]] auto children() const -> const std::pmr::vector<node_ptr>&;
       [[nodiscard]] auto lexeme() const -> std::string_view;
+      /**
+       * @brief The lexeme of the node, interned in the global `munster::string_interner` when the
+       * node was built
+       */
+      [[nodiscard]] auto lexeme_id() const noexcept -> string_id;
       [[nodiscard]] auto location() const -> const source_location&;
 
       void make_child(node_ptr child);
 
-      virtual void accept(visitor_variant& visitor) const = 0;
+      /**
+       * @brief Walk the subtree of the node with a single visitor
+       */
+      void accept(visitor_variant& visitor) const;
+      /**
+       * @brief Walk the subtree of the node once, visiting every node with each visitor of the
+       * group. The walk keeps its own stack, see `ast::walk`, so it does not recurse no matter how
+       * deep the tree is
+       */
+      void accept(visitor_group visitors) const;
+
+      /**
+       * @brief Called by `accept` when the walk reaches the node, before any of its children.
+       * Tells the walk whether the children of the node should be visited
+       */
+      [[nodiscard]] virtual auto enter(visitor_group visitors) const -> traversal_action = 0;
+      /**
+       * @brief Called by `accept` once the walk is done with the children of the node
+       */
+      virtual void leave(visitor_group visitors) const = 0;
 
       [[nodiscard]] virtual auto to_string() const -> std::string = 0;
 
@@ -69,7 +171,7 @@ namespace munster::ast
       void visit(visitor_variant& visitor);
 
       template <typename... NodeTypes>
-      void make_family_e(std::vector<std::variant<std::unique_ptr<NodeTypes>...>>&& children)
+      void make_family_e(std::vector<std::variant<arena_ptr<NodeTypes>...>>&& children)
       {
          for (std::variant<NodeTypes...> node : children | ranges::views::move)
          {
@@ -78,9 +180,9 @@ namespace munster::ast
       }
 
       template <typename NodeType>
-      void make_family_e(std::vector<std::unique_ptr<NodeType>>&& children)
+      void make_family_e(std::vector<arena_ptr<NodeType>>&& children)
       {
-         for (std::unique_ptr<NodeType> node : children | ranges::views::move)
+         for (arena_ptr<NodeType> node : children | ranges::views::move)
          {
             make_child(std::move(node));
          }
@@ -91,18 +193,101 @@ namespace munster::ast
       {
          for (node_ptr node : children | ranges::views::move)
          {
-            assert(detail::is_type<NodeTypes...>); // NOLINT
+            assert(isa<NodeTypes...>(node)); // NOLINT
 
             make_child(std::move(node));
          }
       }
 
    private:
-      std::vector<node_ptr> m_children;
+      std::pmr::vector<node_ptr> m_children{detail::current_resource()};
 
-      std::string m_lexeme;
+      std::pmr::string m_lexeme{detail::current_resource()};
       source_location m_location;
+      string_id m_lexeme_id{};
+      node_kind m_kind;
    };
+
+   /**
+    * @brief Check if a node is of any of the `NodeTypes`
+    */
+   template <typename... NodeTypes>
+   auto isa(const node& n) -> bool
+   {
+      return (detail::is_kind_of<NodeTypes>(n.kind()) || ...);
+   }
+   /**
+    * @brief Check if a node is of any of the `NodeTypes`. A null node is of no type
+    */
+   template <typename... NodeTypes>
+   auto isa(const node* p_node) -> bool
+   {
+      return p_node && isa<NodeTypes...>(*p_node);
+   }
+   /**
+    * @brief Check if a node is of any of the `NodeTypes`. A null node is of no type
+    */
+   template <typename... NodeTypes, typename From>
+   auto isa(const arena_ptr<From>& p_node) -> bool
+   {
+      return isa<NodeTypes...>(static_cast<const node*>(p_node.get()));
+   }
+
+   /**
+    * @brief Convert a node to a `To`. The node must be a `To`
+    */
+   template <typename To>
+   auto cast(node& n) -> To&
+   {
+      assert(isa<To>(n)); // NOLINT
+
+      return static_cast<To&>(n);
+   }
+   template <typename To>
+   auto cast(const node& n) -> const To&
+   {
+      assert(isa<To>(n)); // NOLINT
+
+      return static_cast<const To&>(n);
+   }
+   template <typename To>
+   auto cast(node* p_node) -> To*
+   {
+      assert(isa<To>(p_node)); // NOLINT
+
+      return static_cast<To*>(p_node);
+   }
+   template <typename To>
+   auto cast(const node* p_node) -> const To*
+   {
+      assert(isa<To>(p_node)); // NOLINT
+
+      return static_cast<const To*>(p_node);
+   }
+   template <typename To, typename From>
+   auto cast(const arena_ptr<From>& p_node) -> To*
+   {
+      return cast<To>(static_cast<node*>(p_node.get()));
+   }
+
+   /**
+    * @brief Convert a node to a `To` if it is one, returns `nullptr` otherwise. Accepts null nodes
+    */
+   template <typename To>
+   auto dyn_cast(node* p_node) -> To*
+   {
+      return isa<To>(p_node) ? static_cast<To*>(p_node) : nullptr;
+   }
+   template <typename To>
+   auto dyn_cast(const node* p_node) -> const To*
+   {
+      return isa<To>(p_node) ? static_cast<const To*>(p_node) : nullptr;
+   }
+   template <typename To, typename From>
+   auto dyn_cast(const arena_ptr<From>& p_node) -> To*
+   {
+      return dyn_cast<To>(static_cast<node*>(p_node.get()));
+   }
 }; // namespace munster::ast
 
 template <>
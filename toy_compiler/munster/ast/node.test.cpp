@@ -0,0 +1,133 @@
+/**
+ * @brief Runs tests on functions defined in node.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ast/decl/id_decl.hpp>
+#include <toy_compiler/munster/ast/expr/integer_expr.hpp>
+#include <toy_compiler/munster/ast/node.hpp>
+#include <toy_compiler/munster/ast/op/op.hpp>
+#include <toy_compiler/munster/ast/stmt/stmt.hpp>
+
+#include <range/v3/algorithm/count_if.hpp>
+
+#include <vector>
+
+using namespace munster::ast;
+
+TEST_SUITE("Node test suite")
+{
+   TEST_CASE("kind")
+   {
+      arena arena;
+
+      CHECK(arena.make<id_decl>("x", munster::source_location{})->kind() == node_kind::e_id_decl);
+      CHECK(arena.make<integer_expr>("1", munster::source_location{})->kind() ==
+            node_kind::e_integer_expr);
+   }
+   TEST_CASE("isa")
+   {
+      arena arena;
+
+      const node_ptr id = arena.make<id_decl>("x", munster::source_location{});
+      const node_ptr integer = arena.make<integer_expr>("1", munster::source_location{});
+      const node_ptr null = nullptr;
+
+      SUBCASE("concrete types")
+      {
+         CHECK(isa<id_decl>(id));
+         CHECK_FALSE(isa<id_decl>(integer));
+         CHECK(isa<integer_expr>(*integer));
+      }
+      SUBCASE("abstract types")
+      {
+         CHECK(isa<node>(id));
+         CHECK(isa<decl>(id));
+         CHECK_FALSE(isa<expr>(id));
+         CHECK(isa<decl>(integer));
+         CHECK(isa<expr>(integer));
+         CHECK_FALSE(isa<stmt>(integer));
+         CHECK_FALSE(isa<op>(integer));
+      }
+      SUBCASE("any of many types")
+      {
+         CHECK(isa<op, expr>(integer));
+         CHECK_FALSE(isa<op, stmt>(integer));
+      }
+      SUBCASE("null nodes")
+      {
+         CHECK_FALSE(isa<node>(null));
+         CHECK_FALSE(isa<id_decl>(null.get()));
+      }
+      SUBCASE("isa_pred")
+      {
+         std::vector<node_ptr> nodes;
+         nodes.push_back(arena.make<id_decl>("x", munster::source_location{}));
+         nodes.push_back(arena.make<integer_expr>("1", munster::source_location{}));
+         nodes.push_back(nullptr);
+
+         CHECK(ranges::count_if(nodes, isa_pred<decl>) == 2);
+         CHECK(ranges::count_if(nodes, isa_pred<expr>) == 1);
+      }
+   }
+   TEST_CASE("cast")
+   {
+      arena arena;
+
+      const node_ptr id = arena.make<id_decl>("x", munster::source_location{});
+
+      CHECK(cast<id_decl>(*id).lexeme() == "x");
+      CHECK(cast<decl>(id) == id.get());
+
+      const node* p_node = id.get();
+      CHECK(cast<id_decl>(p_node)->lexeme() == "x");
+   }
+   TEST_CASE("dyn_cast")
+   {
+      arena arena;
+
+      const node_ptr id = arena.make<id_decl>("x", munster::source_location{});
+      const node_ptr null = nullptr;
+
+      CHECK(dyn_cast<id_decl>(id) == id.get());
+      CHECK(dyn_cast<expr>(id) == nullptr);
+      CHECK(dyn_cast<id_decl>(null) == nullptr);
+   }
+   TEST_CASE("node_cast")
+   {
+      arena arena;
+
+      SUBCASE("matching type")
+      {
+         node_ptr id = arena.make<id_decl>("x", munster::source_location{});
+         auto* p_id = id.get();
+
+         const auto result = node_cast<id_decl>(std::move(id));
+
+         CHECK(result.get() == p_id);
+         CHECK(id == nullptr);
+      }
+      SUBCASE("mismatching type")
+      {
+         node_ptr id = arena.make<id_decl>("x", munster::source_location{});
+
+         CHECK(node_cast<expr>(std::move(id)) == nullptr);
+      }
+   }
+}
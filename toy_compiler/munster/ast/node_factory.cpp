@@ -71,21 +71,21 @@ namespace munster::ast
 {
    namespace vi = ranges::views;
 
-   auto pop(std::vector<node_ptr>& stack) -> std::unique_ptr<node>
+   auto pop(std::vector<node_ptr>& stack) -> node_ptr
    {
       auto temp = std::move(*(std::end(stack) - 1));
       stack.pop_back();
       return temp;
    }
 
-   auto node_factory(grammar::action action, const lex_item& item, std::vector<node_ptr>& recs)
-      -> node_ptr
+   auto node_factory(grammar::action action, const lex_item& item, std::string_view source,
+                     std::vector<node_ptr>& recs, arena& node_arena) -> node_ptr
    {
       using namespace mpark::patterns;
 
       if (action == grammar::action::e_type_decl)
       {
-         return std::make_unique<type_decl>(item.lexeme, item.pos);
+         return node_arena.make<type_decl>(lexeme(item, source), item.pos);
       }
 
       if (action == grammar::action::e_compound_func_decl)
@@ -96,7 +96,7 @@ namespace munster::ast
          if (std::size(recs) >= 1)
          {
             std::vector<node_ptr> place_holders = recs | vi::reverse |
-               vi::take_while(detail::is_type<func_decl>) | vi::move | ranges::to_vector;
+               vi::take_while(isa_pred<func_decl>) | vi::move | ranges::to_vector;
 
             std::vector<func_decl::ptr> class_decls;
             for (auto& node : place_holders | vi::reverse)
@@ -105,10 +105,10 @@ namespace munster::ast
                class_decls.push_back(node_cast<func_decl>(std::move(node)));
             }
 
-            return std::make_unique<compound_func_decl>(std::move(class_decls));
+            return node_arena.make<compound_func_decl>(std::move(class_decls));
          }
 
-         return std::make_unique<compound_func_decl>(std::vector<func_decl::ptr>{});
+         return node_arena.make<compound_func_decl>(std::vector<func_decl::ptr>{});
       }
 
       if (action == grammar::action::e_func_decl)
@@ -116,7 +116,7 @@ namespace munster::ast
          node_ptr statements = pop(recs);
          node_ptr function_head = pop(recs);
 
-         return std::make_unique<func_decl>(std::move(function_head), std::move(statements));
+         return node_arena.make<func_decl>(std::move(function_head), std::move(statements));
       }
 
       if (action == grammar::action::e_func_head_decl)
@@ -127,7 +127,7 @@ namespace munster::ast
          node_ptr id = pop(recs);
          node_ptr location = pop(recs);
 
-         return std::make_unique<func_head_decl>(
+         return node_arena.make<func_head_decl>(
             std::move(location), std::move(id), std::move(class_method), std::move(function_params),
             std::move(return_type));
       }
@@ -137,7 +137,7 @@ namespace munster::ast
          node_ptr statements = pop(recs);
          node_ptr variables = pop(recs);
 
-         return std::make_unique<func_body_decl>(std::move(variables), std::move(statements));
+         return node_arena.make<func_body_decl>(std::move(variables), std::move(statements));
       }
 
       if (action == grammar::action::e_compound_class_decl)
@@ -150,7 +150,7 @@ namespace munster::ast
             // clang-format off
             std::vector place_holder = recs 
                | vi::reverse 
-               | vi::take_while(detail::is_type<class_decl>) 
+               | vi::take_while(isa_pred<class_decl>) 
                | vi::move
                | ranges::to_vector;
             // clang-format on
@@ -162,10 +162,10 @@ namespace munster::ast
                class_decls.push_back(node_cast<class_decl>(std::move(node)));
             }
 
-            return std::make_unique<compound_class_decl>(std::move(class_decls));
+            return node_arena.make<compound_class_decl>(std::move(class_decls));
          }
 
-         return std::make_unique<compound_class_decl>(std::vector<class_decl::ptr>{});
+         return node_arena.make<compound_class_decl>(std::vector<class_decl::ptr>{});
       }
 
       if (action == grammar::action::e_class_decl)
@@ -175,9 +175,9 @@ namespace munster::ast
          node_ptr class_name = pop(recs);
          node_ptr class_start = pop(recs);
 
-         return std::make_unique<class_decl>(std::move(class_start), std::move(class_name),
-                                             std::move(compound_inheritance),
-                                             std::move(compound_member));
+         return node_arena.make<class_decl>(std::move(class_start), std::move(class_name),
+                                            std::move(compound_inheritance),
+                                            std::move(compound_member));
       }
 
       if (action == grammar::action::e_compound_inheritance_decl)
@@ -185,12 +185,10 @@ namespace munster::ast
          std::vector<node_ptr> nodes;
          auto null = pop(recs);
 
-         if (std::size(recs) >= 1 && dynamic_cast<inheritance_decl*>(recs.back().get()))
+         if (std::size(recs) >= 1 && isa<inheritance_decl>(recs.back()))
          {
             std::vector<node_ptr> placeholder;
-            for (auto& node : recs | vi::reverse | vi::take_while([](node_ptr& node) {
-                                 return dynamic_cast<inheritance_decl*>(node.get());
-                              }))
+            for (auto& node : recs | vi::reverse | vi::take_while(isa_pred<inheritance_decl>))
             {
                placeholder.push_back(std::move(node));
             }
@@ -202,15 +200,15 @@ namespace munster::ast
                nodes.push_back(std::move(node));
             }
 
-            return std::make_unique<compound_inheritance_decl>(std::move(nodes));
+            return node_arena.make<compound_inheritance_decl>(std::move(nodes));
          }
 
-         return std::make_unique<compound_inheritance_decl>(std::vector<node_ptr>{});
+         return node_arena.make<compound_inheritance_decl>(std::vector<node_ptr>{});
       }
 
       if (action == grammar::action::e_inheritance_decl)
       {
-         return std::make_unique<inheritance_decl>(item.lexeme, item.pos);
+         return node_arena.make<inheritance_decl>(lexeme(item, source), item.pos);
       }
 
       if (action == grammar::action::e_compound_member_decl)
@@ -221,7 +219,7 @@ namespace munster::ast
          if (std::size(recs) >= 1)
          {
             std::vector place_holders = recs | vi::reverse |
-               vi::take_while(detail::is_type<member_func_decl, member_var_decl>) | vi::move |
+               vi::take_while(isa_pred<member_func_decl, member_var_decl>) | vi::move |
                ranges::to_vector;
 
             std::vector<node_ptr> nodes;
@@ -231,10 +229,10 @@ namespace munster::ast
                nodes.push_back(std::move(node));
             }
 
-            return std::make_unique<compound_member_decl>(std::move(nodes));
+            return node_arena.make<compound_member_decl>(std::move(nodes));
          }
 
-         return std::make_unique<compound_member_decl>(std::vector<node_ptr>{});
+         return node_arena.make<compound_member_decl>(std::vector<node_ptr>{});
       }
 
       if (action == grammar::action::e_member_var_decl)
@@ -244,13 +242,13 @@ namespace munster::ast
          node_ptr type = pop(recs);
          node_ptr visibility = pop(recs);
 
-         return std::make_unique<member_var_decl>(std::move(visibility), std::move(type),
-                                                  std::move(id), std::move(compound_array));
+         return node_arena.make<member_var_decl>(std::move(visibility), std::move(type),
+                                                 std::move(id), std::move(compound_array));
       }
 
       if (action == grammar::action::e_visibily_decl)
       {
-         node_ptr vis = std::make_unique<visibility_decl>(item.lexeme, item.pos);
+         node_ptr vis = node_arena.make<visibility_decl>(lexeme(item, source), item.pos);
 
          return vis;
       }
@@ -261,8 +259,8 @@ namespace munster::ast
          node_ptr id = pop(recs);
          node_ptr type = pop(recs);
 
-         return std::make_unique<variable_decl>(std::move(type), std::move(id),
-                                                std::move(compound_array));
+         return node_arena.make<variable_decl>(std::move(type), std::move(id),
+                                               std::move(compound_array));
       }
 
       if (action == grammar::action::e_compound_array_decl)
@@ -270,12 +268,10 @@ namespace munster::ast
          std::vector<node_ptr> nodes;
          auto null = pop(recs);
 
-         if (std::size(recs) >= 1 && dynamic_cast<array_decl*>(recs.back().get()))
+         if (std::size(recs) >= 1 && isa<array_decl>(recs.back()))
          {
             std::vector<node_ptr> placeholder;
-            for (auto& node : recs | vi::reverse | vi::take_while([](node_ptr& node) {
-                                 return dynamic_cast<array_decl*>(node.get());
-                              }))
+            for (auto& node : recs | vi::reverse | vi::take_while(isa_pred<array_decl>))
             {
                placeholder.push_back(std::move(node));
             }
@@ -287,10 +283,10 @@ namespace munster::ast
                nodes.push_back(std::move(node));
             }
 
-            return std::make_unique<compound_array_decl>(std::move(nodes));
+            return node_arena.make<compound_array_decl>(std::move(nodes));
          }
 
-         return std::make_unique<compound_array_decl>(std::vector<node_ptr>{});
+         return node_arena.make<compound_array_decl>(std::vector<node_ptr>{});
       }
 
       if (action == grammar::action::e_array_decl)
@@ -299,8 +295,8 @@ namespace munster::ast
          node_ptr size = pop(recs);
          node_ptr beg_loc = pop(recs);
 
-         return std::make_unique<array_decl>(std::move(beg_loc), std::move(size),
-                                             std::move(end_loc));
+         return node_arena.make<array_decl>(std::move(beg_loc), std::move(size),
+                                            std::move(end_loc));
       }
 
       if (action == grammar::action::e_member_func_decl)
@@ -311,9 +307,9 @@ namespace munster::ast
          node_ptr location = pop(recs);
          node_ptr visibility = pop(recs);
 
-         return std::make_unique<member_func_decl>(std::move(visibility), std::move(location),
-                                                   std::move(id), std::move(compound_param),
-                                                   std::move(tail));
+         return node_arena.make<member_func_decl>(std::move(visibility), std::move(location),
+                                                  std::move(id), std::move(compound_param),
+                                                  std::move(tail));
       }
 
       if (action == grammar::action::e_compound_param_decl)
@@ -323,12 +319,10 @@ namespace munster::ast
 
          assert(epsilon == nullptr); // NOLINT
 
-         if (std::size(recs) >= 1 && dynamic_cast<variable_decl*>(recs.back().get()))
+         if (std::size(recs) >= 1 && isa<variable_decl>(recs.back()))
          {
             std::vector<node_ptr> placeholder;
-            for (auto& node : recs | vi::reverse | vi::take_while([](node_ptr& node) {
-                                 return dynamic_cast<variable_decl*>(node.get());
-                              }))
+            for (auto& node : recs | vi::reverse | vi::take_while(isa_pred<variable_decl>))
             {
                placeholder.push_back(std::move(node));
             }
@@ -340,10 +334,10 @@ namespace munster::ast
                nodes.push_back(std::move(node));
             }
 
-            return std::make_unique<compound_params_decl>(std::move(nodes));
+            return node_arena.make<compound_params_decl>(std::move(nodes));
          }
 
-         return std::make_unique<compound_params_decl>(std::vector<node_ptr>{});
+         return node_arena.make<compound_params_decl>(std::vector<node_ptr>{});
       }
 
       if (action == grammar::action::e_compound_variable_decl)
@@ -351,10 +345,10 @@ namespace munster::ast
          std::vector<node_ptr> nodes;
          node_ptr null = pop(recs);
 
-         if (std::size(recs) >= 1 && dynamic_cast<variable_decl*>(recs.back().get()))
+         if (std::size(recs) >= 1 && isa<variable_decl>(recs.back()))
          {
             std::vector place_holders = recs | vi::reverse |
-               vi::take_while(detail::is_type<variable_decl>) | vi::move | ranges::to_vector;
+               vi::take_while(isa_pred<variable_decl>) | vi::move | ranges::to_vector;
 
             std::vector<node_ptr> nodes;
             for (auto& node : place_holders | vi::reverse)
@@ -363,10 +357,10 @@ namespace munster::ast
                nodes.push_back(std::move(node));
             }
 
-            return std::make_unique<compound_variable_decl>(std::move(nodes));
+            return node_arena.make<compound_variable_decl>(std::move(nodes));
          }
 
-         return std::make_unique<compound_variable_decl>(std::vector<node_ptr>{});
+         return node_arena.make<compound_variable_decl>(std::vector<node_ptr>{});
       }
 
       if (action == grammar::action::e_rel_op)
@@ -375,9 +369,9 @@ namespace munster::ast
          node_ptr id = pop(recs);
          node_ptr term_0 = pop(recs);
 
-         assert(dynamic_cast<id_decl*>(id.get())); // NOLINT
+         assert(isa<id_decl>(id)); // NOLINT
 
-         return std::make_unique<rel_op>(std::move(term_0), std::move(id), std::move(term_1));
+         return node_arena.make<rel_op>(std::move(term_0), std::move(id), std::move(term_1));
       }
 
       if (action == grammar::action::e_add_op)
@@ -386,21 +380,21 @@ namespace munster::ast
          node_ptr id = pop(recs);
          node_ptr factor_0 = pop(recs);
 
-         assert(dynamic_cast<id_decl*>(id.get())); // NOLINT
+         assert(isa<id_decl>(id)); // NOLINT
 
-         return std::make_unique<add_op>(std::move(factor_0), std::move(id), std::move(factor_1));
+         return node_arena.make<add_op>(std::move(factor_0), std::move(id), std::move(factor_1));
       }
 
       if (action == grammar::action::e_dot_op)
       {
          node_ptr expr_1 = pop(recs);
 
-         if (dynamic_cast<dot_decl*>(recs.back().get()))
+         if (isa<dot_decl>(recs.back()))
          {
             node_ptr dot = pop(recs);
             node_ptr expr_0 = pop(recs);
 
-            return std::make_unique<dot_op>(std::move(expr_0), std::move(dot), std::move(expr_1));
+            return node_arena.make<dot_op>(std::move(expr_0), std::move(dot), std::move(expr_1));
          }
 
          return expr_1;
@@ -413,12 +407,12 @@ namespace munster::ast
          node_ptr factor_0 = pop(recs);
 
          /*
-         assert(dynamic_cast<expr*>(factor_0.get())); // NOLINT
-         assert(dynamic_cast<id_decl*>(id.get()));    // NOLINT
-         assert(dynamic_cast<expr*>(factor_1.get())); // NOLINT
+         assert(isa<expr>(factor_0)); // NOLINT
+         assert(isa<id_decl>(id));    // NOLINT
+         assert(isa<expr>(factor_1)); // NOLINT
          */
 
-         return std::make_unique<mult_op>(std::move(factor_0), std::move(id), std::move(factor_1));
+         return node_arena.make<mult_op>(std::move(factor_0), std::move(id), std::move(factor_1));
       }
 
       if (action == grammar::action::e_assign_op)
@@ -427,29 +421,29 @@ namespace munster::ast
          node_ptr id = pop(recs);
          node_ptr value_0 = pop(recs);
 
-         const bool val_0_check = detail::is_type<expr, op>(value_0);
-         const bool val_1_check = detail::is_type<expr, op>(value_1);
+         const bool val_0_check = isa<expr, op>(value_0);
+         const bool val_1_check = isa<expr, op>(value_1);
 
-         assert(val_0_check);                      // NOLINT
-         assert(val_1_check);                      // NOLINT
-         assert(dynamic_cast<id_decl*>(id.get())); // NOLINT
+         assert(val_0_check);      // NOLINT
+         assert(val_1_check);      // NOLINT
+         assert(isa<id_decl>(id)); // NOLINT
 
-         return std::make_unique<assign_op>(std::move(value_0), std::move(id), std::move(value_1));
+         return node_arena.make<assign_op>(std::move(value_0), std::move(id), std::move(value_1));
       }
 
       if (action == grammar::action::e_int_expr)
       {
-         return std::make_unique<integer_expr>(item.lexeme, item.pos);
+         return node_arena.make<integer_expr>(lexeme(item, source), item.pos);
       }
 
       if (action == grammar::action::e_float_expr)
       {
-         return std::make_unique<float_expr>(item.lexeme, item.pos);
+         return node_arena.make<float_expr>(lexeme(item, source), item.pos);
       }
 
       if (action == grammar::action::e_str_expr)
       {
-         return std::make_unique<string_expr>(item.lexeme, item.pos);
+         return node_arena.make<string_expr>(lexeme(item, source), item.pos);
       }
 
       if (action == grammar::action::e_priority_expr)
@@ -457,7 +451,7 @@ namespace munster::ast
          node_ptr expr = pop(recs);
          node_ptr location = pop(recs);
 
-         return std::make_unique<priority_expr>(std::move(location), std::move(expr));
+         return node_arena.make<priority_expr>(std::move(location), std::move(expr));
       }
 
       if (action == grammar::action::e_not_expr)
@@ -465,7 +459,7 @@ namespace munster::ast
          node_ptr factor = pop(recs);
          node_ptr id = pop(recs);
 
-         return std::make_unique<not_expr>(std::move(id), std::move(factor));
+         return node_arena.make<not_expr>(std::move(id), std::move(factor));
       }
 
       if (action == grammar::action::e_not_expr)
@@ -473,7 +467,7 @@ namespace munster::ast
          node_ptr factor = pop(recs);
          node_ptr id = pop(recs);
 
-         return std::make_unique<not_expr>(std::move(id), std::move(factor));
+         return node_arena.make<not_expr>(std::move(id), std::move(factor));
       }
 
       if (action == grammar::action::e_sign_expr)
@@ -481,17 +475,17 @@ namespace munster::ast
          node_ptr factor = pop(recs);
          node_ptr id = pop(recs);
 
-         assert(dynamic_cast<id_decl*>(id.get())); // NOLINT
+         assert(isa<id_decl>(id)); // NOLINT
          // NOLINTNEXTLINE
-         assert(dynamic_cast<expr*>(factor.get()) || dynamic_cast<mult_op*>(factor.get()));
+         assert((isa<expr, mult_op>(factor)));
 
-         return std::make_unique<sign_expr>(std::move(id), std::move(factor));
+         return node_arena.make<sign_expr>(std::move(id), std::move(factor));
       }
 
       if (action == grammar::action::e_func_or_assign_stmt)
       {
          std::vector place_holders = recs | vi::reverse |
-            vi::take_while(detail::is_type<expr, op>) | vi::move | ranges::to_vector;
+            vi::take_while(isa_pred<expr, op>) | vi::move | ranges::to_vector;
 
          std::vector<node_ptr> nodes;
          for (auto& node : place_holders | vi::reverse)
@@ -500,13 +494,13 @@ namespace munster::ast
             nodes.push_back(std::move(node));
          }
 
-         return std::make_unique<func_stmt>(std::move(nodes));
+         return node_arena.make<func_stmt>(std::move(nodes));
       }
 
       if (action == grammar::action::e_compound_var_expr)
       {
          std::vector place_holders = recs | vi::reverse |
-            vi::take_while(detail::is_type<var_expr>) | vi::move | ranges::to_vector;
+            vi::take_while(isa_pred<var_expr>) | vi::move | ranges::to_vector;
 
          std::vector<node_ptr> nodes;
          for (auto& node : place_holders | vi::reverse)
@@ -515,7 +509,7 @@ namespace munster::ast
             nodes.push_back(std::move(node));
          }
 
-         return std::make_unique<compound_var_expr_decl>(std::move(nodes));
+         return node_arena.make<compound_var_expr_decl>(std::move(nodes));
       }
 
       if (action == grammar::action::e_compound_parameter_expr_decl)
@@ -528,7 +522,7 @@ namespace munster::ast
             // clang-format off
             std::vector<node_ptr> placeholder = recs 
                | vi::reverse 
-               | vi::take_while(detail::is_type<expr, op>) 
+               | vi::take_while(isa_pred<expr, op>) 
                | vi::move 
                | ranges::to_vector;
             // clang-format on
@@ -540,10 +534,10 @@ namespace munster::ast
                nodes.push_back(std::move(node));
             }
 
-            return std::make_unique<compound_parameter_expr_decl>(std::move(nodes));
+            return node_arena.make<compound_parameter_expr_decl>(std::move(nodes));
          }
 
-         return std::make_unique<compound_parameter_expr_decl>(std::vector<node_ptr>{});
+         return node_arena.make<compound_parameter_expr_decl>(std::vector<node_ptr>{});
       }
 
       if (action == grammar::action::e_var_expr)
@@ -551,7 +545,7 @@ namespace munster::ast
          node_ptr compound_array_index_access = pop(recs);
          node_ptr id = pop(recs);
 
-         return std::make_unique<var_expr>(std::move(id), std::move(compound_array_index_access));
+         return node_arena.make<var_expr>(std::move(id), std::move(compound_array_index_access));
       }
 
       if (action == grammar::action::e_compound_array_index_access_decl)
@@ -559,11 +553,11 @@ namespace munster::ast
          std::vector<node_ptr> nodes;
          auto null = pop(recs);
 
-         if (std::size(recs) >= 1 && dynamic_cast<array_index_access_decl*>(recs.back().get()))
+         if (std::size(recs) >= 1 && isa<array_index_access_decl>(recs.back()))
          {
             std::vector<node_ptr> placeholder;
             for (auto& node :
-                 recs | vi::reverse | vi::take_while(detail::is_type<array_index_access_decl>))
+                 recs | vi::reverse | vi::take_while(isa_pred<array_index_access_decl>))
             {
                placeholder.push_back(std::move(node));
             }
@@ -575,10 +569,10 @@ namespace munster::ast
                nodes.push_back(std::move(node));
             }
 
-            return std::make_unique<compound_array_index_access_decl>(std::move(nodes));
+            return node_arena.make<compound_array_index_access_decl>(std::move(nodes));
          }
 
-         return std::make_unique<compound_array_index_access_decl>(std::vector<node_ptr>{});
+         return node_arena.make<compound_array_index_access_decl>(std::vector<node_ptr>{});
       }
 
       if (action == grammar::action::e_array_index_access_decl)
@@ -587,8 +581,8 @@ namespace munster::ast
          node_ptr expr = pop(recs);
          node_ptr beg = pop(recs);
 
-         return std::make_unique<array_index_access_decl>(std::move(beg), std::move(expr),
-                                                          std::move(end));
+         return node_arena.make<array_index_access_decl>(std::move(beg), std::move(expr),
+                                                         std::move(end));
       }
 
       if (action == grammar::action::e_ternary_expr)
@@ -598,8 +592,8 @@ namespace munster::ast
          node_ptr condition = pop(recs);
          node_ptr location = pop(recs);
 
-         return std::make_unique<ternary_expr>(std::move(location), std::move(condition),
-                                               std::move(expr_0), std::move(expr_1));
+         return node_arena.make<ternary_expr>(std::move(location), std::move(condition),
+                                              std::move(expr_0), std::move(expr_1));
       }
 
       if (action == grammar::action::e_compound_stmt)
@@ -610,7 +604,7 @@ namespace munster::ast
          if (std::size(recs) >= 1)
          {
             std::vector<node_ptr> placeholder = recs | vi::reverse |
-               vi::take_while(detail::is_type<stmt>) | vi::move | ranges::to<std::vector>;
+               vi::take_while(isa_pred<stmt>) | vi::move | ranges::to<std::vector>;
 
             std::vector<node_ptr> nodes;
             for (auto& node : placeholder | vi::reverse)
@@ -619,10 +613,10 @@ namespace munster::ast
                nodes.push_back(std::move(node));
             }
 
-            return std::make_unique<compound_stmt>(std::move(nodes));
+            return node_arena.make<compound_stmt>(std::move(nodes));
          }
 
-         return std::make_unique<compound_stmt>(std::vector<node_ptr>{});
+         return node_arena.make<compound_stmt>(std::vector<node_ptr>{});
       }
 
       if (action == grammar::action::e_if_stmt)
@@ -632,8 +626,8 @@ namespace munster::ast
          node_ptr expr = pop(recs);
          node_ptr location = pop(recs);
 
-         return std::make_unique<if_stmt>(std::move(location), std::move(expr),
-                                          std::move(then_block), std::move(else_block));
+         return node_arena.make<if_stmt>(std::move(location), std::move(expr),
+                                         std::move(then_block), std::move(else_block));
       }
 
       if (action == grammar::action::e_while_stmt)
@@ -642,8 +636,8 @@ namespace munster::ast
          node_ptr expr = pop(recs);
          node_ptr location = pop(recs);
 
-         return std::make_unique<while_stmt>(std::move(location), std::move(expr),
-                                             std::move(stmt_block));
+         return node_arena.make<while_stmt>(std::move(location), std::move(expr),
+                                            std::move(stmt_block));
       }
 
       if (action == grammar::action::e_write_stmt)
@@ -651,7 +645,7 @@ namespace munster::ast
          node_ptr expr = pop(recs);
          node_ptr id = pop(recs);
 
-         return std::make_unique<write_stmt>(std::move(id), std::move(expr));
+         return node_arena.make<write_stmt>(std::move(id), std::move(expr));
       }
 
       if (action == grammar::action::e_read_stmt)
@@ -659,7 +653,7 @@ namespace munster::ast
          node_ptr compound_var = pop(recs);
          node_ptr loc = pop(recs);
 
-         return std::make_unique<read_stmt>(std::move(loc), std::move(compound_var));
+         return node_arena.make<read_stmt>(std::move(loc), std::move(compound_var));
       }
 
       return match(action)(
@@ -668,52 +662,52 @@ namespace munster::ast
             node_ptr compound_function_decl = pop(recs);
             auto compound_class = node_cast<compound_class_decl>(pop(recs));
 
-            return std::make_unique<translation_unit_decl>(
+            return node_arena.make<translation_unit_decl>(
                std::move(compound_class), std::move(compound_function_decl), std::move(main_decl));
          },
          pattern(grammar::action::e_location_decl) = [&]() -> node_ptr {
-            return std::make_unique<location_decl>(item.pos);
+            return node_arena.make<location_decl>(item.pos);
          },
          pattern(grammar::action::e_id_decl) = [&]() -> node_ptr {
-            return std::make_unique<id_decl>(item.lexeme, item.pos);
+            return node_arena.make<id_decl>(lexeme(item, source), item.pos);
          },
          pattern(grammar::action::e_dot_decl) = [&]() -> node_ptr {
-            return std::make_unique<dot_decl>(item.lexeme, item.pos);
+            return node_arena.make<dot_decl>(lexeme(item, source), item.pos);
          },
          pattern(grammar::action::e_main_decl) = [&]() -> node_ptr {
             auto func_body = node_cast<func_body_decl>(pop(recs));
             auto id = node_cast<id_decl>(pop(recs));
 
-            return std::make_unique<main_decl>(std::move(id), std::move(func_body));
+            return node_arena.make<main_decl>(std::move(id), std::move(func_body));
          },
          pattern(grammar::action::e_func_expr) = [&]() -> node_ptr {
             auto compound_param_expr = node_cast<compound_parameter_expr_decl>(pop(recs));
             auto id = node_cast<id_decl>(pop(recs));
 
-            return std::make_unique<func_expr>(std::move(id), std::move(compound_param_expr));
+            return node_arena.make<func_expr>(std::move(id), std::move(compound_param_expr));
          },
          pattern(grammar::action::e_assign_stmt) = [&]() -> node_ptr {
             auto assign = node_cast<assign_op>(pop(recs));
 
-            return std::make_unique<assign_stmt>(std::move(assign));
+            return node_arena.make<assign_stmt>(std::move(assign));
          },
          pattern(grammar::action::e_return_stmt) = [&]() -> node_ptr {
             node_ptr expr = pop(recs);
             node_ptr id = pop(recs);
 
-            return std::make_unique<return_stmt>(std::move(id), std::move(expr));
+            return node_arena.make<return_stmt>(std::move(id), std::move(expr));
          },
          pattern(grammar::action::e_break_stmt) = [&]() -> node_ptr {
-            return std::make_unique<break_stmt>(item.lexeme, item.pos);
+            return node_arena.make<break_stmt>(lexeme(item, source), item.pos);
          },
          pattern(grammar::action::e_continue_stmt) = [&]() -> node_ptr {
-            return std::make_unique<continue_stmt>(item.lexeme, item.pos);
+            return node_arena.make<continue_stmt>(lexeme(item, source), item.pos);
          },
          pattern(grammar::action::e_stmt_block_decl) = [&]() -> node_ptr {
-            return std::make_unique<stmt_block_decl>(pop(recs));
+            return node_arena.make<stmt_block_decl>(pop(recs));
          },
          pattern(grammar::action::e_integer_literal) = [&]() -> node_ptr {
-            return std::make_unique<integer_literal>(item.lexeme, item.pos);
+            return node_arena.make<integer_literal>(lexeme(item, source), item.pos);
          },
          pattern(_) = [&]() -> node_ptr {
             return nullptr;
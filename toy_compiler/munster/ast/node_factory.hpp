@@ -2,6 +2,6 @@
 
 namespace munster::ast
 {
-   auto node_factory(grammar::action type, const lex_item& item, std::vector<node_ptr>& recs)
-      -> node_ptr;
+   auto node_factory(grammar::action type, const lex_item& item, std::string_view source,
+                     std::vector<node_ptr>& recs, arena& node_arena) -> node_ptr;
 }; // namespace munster::ast
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <magic_enum.hpp>
+
+#include <fmt/core.h>
+
+#include <cstdint>
+
+namespace munster::ast
+{
+   /**
+    * @brief The concrete type of a node of the AST, stored in every `ast::node` so that inspecting
+    * the type of a node is a single comparison, see `ast::isa`, `ast::cast` & `ast::dyn_cast`.
+    *
+    * The kinds of a family of nodes are kept next to each other so that the abstract node types
+    * (`ast::decl`, `ast::expr`, `ast::op`, ...) map to a contiguous range of kinds. The `ast::expr`
+    * nodes are `ast::decl` nodes and must stay at the end of the declarations.
+    */
+   enum struct node_kind : std::uint8_t
+   {
+      // decl
+      e_array_index_access_decl,
+      e_compound_array_index_access_decl,
+      e_array_decl,
+      e_compound_array_decl,
+      e_class_decl,
+      e_compound_class_decl,
+      e_compound_member_decl,
+      e_compound_params_decl,
+      e_dot_decl,
+      e_func_body_decl,
+      e_func_decl,
+      e_compound_func_decl,
+      e_func_head_decl,
+      e_id_decl,
+      e_inheritance_decl,
+      e_compound_inheritance_decl,
+      e_location_decl,
+      e_main_decl,
+      e_member_func_decl,
+      e_member_var_decl,
+      e_stmt_block_decl,
+      e_translation_unit_decl,
+      e_type_decl,
+      e_variable_decl,
+      e_compound_variable_decl,
+      e_visibility_decl,
+      e_compound_parameter_expr_decl,
+
+      // expr
+      e_compound_var_expr_decl,
+      e_float_expr,
+      e_func_expr,
+      e_integer_expr,
+      e_not_expr,
+      e_priority_expr,
+      e_sign_expr,
+      e_string_expr,
+      e_ternary_expr,
+      e_var_expr,
+
+      // literal
+      e_integer_literal,
+
+      // op
+      e_add_op,
+      e_assign_op,
+      e_dot_op,
+      e_mult_op,
+      e_rel_op,
+
+      // stmt
+      e_assign_stmt,
+      e_break_stmt,
+      e_compound_stmt,
+      e_continue_stmt,
+      e_func_stmt,
+      e_if_stmt,
+      e_read_stmt,
+      e_return_stmt,
+      e_while_stmt,
+      e_write_stmt
+   };
+} // namespace munster::ast
+
+/**
+ * @brief A specialization for using the `ast::node_kind` enum in the **fmt** & **spdlog**
+ * libraries
+ */
+template <>
+struct fmt::formatter<munster::ast::node_kind>
+{
+   template <typename ParseContex>
+   constexpr auto parse(ParseContex& ctx)
+   {
+      return ctx.begin();
+   }
+
+   template <typename FormatContext>
+   auto format(munster::ast::node_kind kind, FormatContext& ctx)
+   {
+      return fmt::format_to(ctx.out(), "{}", magic_enum::enum_name(kind));
+   }
+};
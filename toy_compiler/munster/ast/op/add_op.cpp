@@ -5,22 +5,19 @@
 namespace munster::ast
 {
    add_op::add_op(node_ptr term_0, node_ptr value, node_ptr term_1) :
-      op{std::string{value->lexeme()}, value->location()}
+      op{static_kind, std::string{value->lexeme()}, value->location()}
    {
       make_child(std::move(term_0));
       make_child(std::move(term_1));
    }
 
-   void add_op::accept(visitor_variant& visitor) const
+   auto add_op::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void add_op::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto add_op::to_string() const -> std::string
    {
       return fmt::format("operator{} {}", lexeme(), location());
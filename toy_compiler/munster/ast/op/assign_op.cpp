@@ -10,22 +10,19 @@
 namespace munster::ast
 {
    assign_op::assign_op(node_ptr val_0, node_ptr id_decl, node_ptr val_1) :
-      op{std::string{id_decl->lexeme()}, id_decl->location()}
+      op{static_kind, std::string{id_decl->lexeme()}, id_decl->location()}
    {
       make_child(std::move(val_0));
       make_child(std::move(val_1));
    }
 
-   void assign_op::accept(visitor_variant& visitor) const
+   auto assign_op::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void assign_op::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto assign_op::to_string() const -> std::string
    {
       return fmt::format("operator{} {}", lexeme(), location());
@@ -7,12 +7,14 @@ namespace munster::ast
    class assign_op : public op
    {
    public:
-      using ptr = std::unique_ptr<assign_op>;
+      using ptr = arena_ptr<assign_op>;
+      static constexpr node_kind static_kind = node_kind::e_assign_op;
 
    public:
       assign_op(node_ptr val_0, node_ptr id_decl, node_ptr val_1);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
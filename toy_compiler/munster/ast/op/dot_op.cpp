@@ -5,22 +5,19 @@
 namespace munster::ast
 {
    dot_op::dot_op(node_ptr caller, node_ptr id, node_ptr callee) :
-      op{std::string{id->lexeme()}, id->location()}
+      op{static_kind, std::string{id->lexeme()}, id->location()}
    {
       make_child(std::move(caller));
       make_child(std::move(callee));
    }
 
-   void dot_op::accept(visitor_variant& visitor) const
+   auto dot_op::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void dot_op::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto dot_op::to_string() const -> std::string
    {
       return fmt::format("operator{} {}", lexeme(), location());
@@ -7,9 +7,12 @@ namespace munster::ast
    class dot_op : public op
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_dot_op;
+
       dot_op(node_ptr caller, node_ptr id, node_ptr callee);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -5,22 +5,19 @@
 namespace munster::ast
 {
    mult_op::mult_op(node_ptr factor_0, node_ptr value, node_ptr factor_1) :
-      op{std::string{value->lexeme()}, value->location()}
+      op{static_kind, std::string{value->lexeme()}, value->location()}
    {
       make_child(std::move(factor_0));
       make_child(std::move(factor_1));
    }
 
-   void mult_op::accept(visitor_variant& visitor) const
+   auto mult_op::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void mult_op::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto mult_op::to_string() const -> std::string
    {
       return fmt::format("operator{} <line:{}, col:{}>", lexeme(), location().line,
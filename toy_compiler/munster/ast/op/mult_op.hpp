@@ -7,9 +7,12 @@ namespace munster::ast
    class mult_op : public op
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_mult_op;
+
       mult_op(node_ptr factor_0, node_ptr value, node_ptr factor_1);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -2,8 +2,16 @@
 
 namespace munster::ast
 {
-   op::op(const source_location& location) : node{location} {}
-   op::op(const std::string& lexeme, const source_location& location) : node{lexeme, location} {}
+   op::op(node_kind kind) : node{kind} {}
+   op::op(node_kind kind, const source_location& location) : node{kind, location} {}
+   op::op(node_kind kind, std::string_view lexeme, const source_location& location) :
+      node{kind, lexeme, location}
+   {}
 
-   void op::accept(visitor_variant& /*visitor*/) const {}
+   auto op::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void op::leave(visitor_group /*visitors*/) const {}
 } // namespace munster::ast
@@ -7,11 +7,16 @@ namespace munster::ast
    class op : public node
    {
    public:
-      op() = default;
-      op(const source_location& location);
-      op(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind first_kind = node_kind::e_add_op;
+      static constexpr node_kind last_kind = node_kind::e_rel_op;
 
-      void accept(visitor_variant& visitor) const override;
+   public:
+      op(node_kind kind);
+      op(node_kind kind, const source_location& location);
+      op(node_kind kind, std::string_view lexeme, const source_location& location);
+
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override = 0;
    };
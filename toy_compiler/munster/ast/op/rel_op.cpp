@@ -5,22 +5,19 @@
 namespace munster::ast
 {
    rel_op::rel_op(node_ptr arith_0, node_ptr value, node_ptr arith_1) :
-      op{std::string{value->lexeme()}, value->location()}
+      op{static_kind, std::string{value->lexeme()}, value->location()}
    {
       make_child(std::move(arith_0));
       make_child(std::move(arith_1));
    }
 
-   void rel_op::accept(visitor_variant& visitor) const
+   auto rel_op::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void rel_op::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto rel_op::to_string() const -> std::string
    {
       return fmt::format("operator{} <line:{}, col:{}>", lexeme(), location().line,
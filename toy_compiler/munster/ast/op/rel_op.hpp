@@ -7,9 +7,12 @@ namespace munster::ast
    class rel_op : public op
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_rel_op;
+
       rel_op(node_ptr arith_expr_0, node_ptr value, node_ptr arith_expr_1);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -4,17 +4,18 @@
 
 namespace munster::ast
 {
-   assign_stmt::assign_stmt(assign_op::ptr assign) { make_child(std::move(assign)); }
-
-   void assign_stmt::accept(visitor_variant& visitor) const
+   assign_stmt::assign_stmt(assign_op::ptr assign) :
+      stmt{static_kind}
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
+      make_child(std::move(assign));
+   }
 
-      visit_node(visitor, *this);
+   auto assign_stmt::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_continue;
    }
 
+   void assign_stmt::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto assign_stmt::to_string() const -> std::string { return "assign_stmt"; }
 } // namespace munster::ast
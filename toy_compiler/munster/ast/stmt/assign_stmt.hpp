@@ -9,9 +9,12 @@ namespace munster::ast
    class assign_stmt : public stmt
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_assign_stmt;
+
       assign_stmt(assign_op::ptr assign);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
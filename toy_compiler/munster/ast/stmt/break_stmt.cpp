@@ -2,8 +2,8 @@
 
 namespace munster::ast
 {
-   break_stmt::break_stmt(const std::string& lexeme, const source_location& location) :
-      stmt{lexeme, location}
+   break_stmt::break_stmt(std::string_view lexeme, const source_location& location) :
+      stmt{static_kind, lexeme, location}
    {}
 
    auto break_stmt::to_string() const -> std::string
@@ -4,20 +4,17 @@
 
 namespace munster::ast
 {
-   compound_stmt::compound_stmt(std::vector<node_ptr>&& statements)
+   compound_stmt::compound_stmt(std::vector<node_ptr>&& statements) : stmt{static_kind}
    {
       make_family<stmt>(std::move(statements));
    }
 
-   void compound_stmt::accept(visitor_variant& visitor) const
+   auto compound_stmt::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void compound_stmt::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto compound_stmt::to_string() const -> std::string { return "compound_stmt"; }
 } // namespace munster::ast
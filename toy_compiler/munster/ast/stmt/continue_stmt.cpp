@@ -2,8 +2,8 @@
 
 namespace munster::ast
 {
-   continue_stmt::continue_stmt(const std::string& lexeme, const source_location& location) :
-      stmt{lexeme, location}
+   continue_stmt::continue_stmt(std::string_view lexeme, const source_location& location) :
+      stmt{static_kind, lexeme, location}
    {}
 
    auto continue_stmt::to_string() const -> std::string
@@ -7,7 +7,9 @@ namespace munster::ast
    class continue_stmt : public stmt
    {
    public:
-      continue_stmt(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind static_kind = node_kind::e_continue_stmt;
+
+      continue_stmt(std::string_view lexeme, const source_location& location);
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -7,12 +7,17 @@
 
 namespace munster::ast
 {
-   func_stmt::func_stmt(std::vector<node_ptr>&& var_or_assign_decls)
+   func_stmt::func_stmt(std::vector<node_ptr>&& var_or_assign_decls) : stmt{static_kind}
    {
       make_family<op, expr>(std::move(var_or_assign_decls));
    }
 
-   void func_stmt::accept(visitor_variant& visitor) const { visit_node(visitor, *this); }
+   auto func_stmt::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void func_stmt::leave(visitor_group visitors) const { visit_node(visitors, *this); }
 
    auto func_stmt::to_string() const -> std::string { return "func_stmt"; }
 } // namespace munster::ast
@@ -7,9 +7,12 @@ namespace munster::ast
    class func_stmt : public stmt
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_func_stmt;
+
       func_stmt(std::vector<node_ptr>&& func);
 
-      void accept(visitor_variant& visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -10,15 +10,13 @@
 namespace munster::ast
 {
    if_stmt::if_stmt(node_ptr loc, node_ptr expr_node, node_ptr then_block, node_ptr else_block) :
-      stmt{loc->location()}
+      stmt{static_kind, loc->location()}
    {
       { // ASSERTION BLOCK
-         using detail::is_type;
-
-         const bool location_assert = is_type<location_decl>(loc);
-         const bool expr_assert = is_type<expr, op>(expr_node);
-         const bool then_assert = is_type<stmt_block_decl>(then_block);
-         const bool else_assert = is_type<stmt_block_decl>(else_block);
+         const bool location_assert = isa<location_decl>(loc);
+         const bool expr_assert = isa<expr, op>(expr_node);
+         const bool then_assert = isa<stmt_block_decl>(then_block);
+         const bool else_assert = isa<stmt_block_decl>(else_block);
 
          assert(location_assert && expr_assert && then_assert && else_assert); // NOLINT
       }
@@ -28,16 +26,13 @@ namespace munster::ast
       make_child(std::move(else_block));
    }
 
-   void if_stmt::accept(visitor_variant& visitor) const
+   auto if_stmt::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void if_stmt::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto if_stmt::to_string() const -> std::string
    {
       return fmt::format("if_stmt <line:{}, col:{}>", location().line, location().column);
@@ -29,6 +29,8 @@ namespace munster::ast
    class if_stmt : public stmt
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_if_stmt;
+
       /**
        * @brief
        *
@@ -39,7 +41,8 @@ namespace munster::ast
        */
       if_stmt(node_ptr location, node_ptr expr, node_ptr then_block, node_ptr else_block);
 
-      void accept(visitor_variant &visitor) const override;
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override;
    };
@@ -2,7 +2,7 @@
 
 namespace munster::ast
 {
-   read_stmt::read_stmt(node_ptr loc, node_ptr var) : stmt{loc->location()}
+   read_stmt::read_stmt(node_ptr loc, node_ptr var) : stmt{static_kind, loc->location()}
    {
       make_child(std::move(var));
    }
@@ -7,6 +7,8 @@ namespace munster::ast
    class read_stmt : public stmt
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_read_stmt;
+
       read_stmt(node_ptr loc, node_ptr compound_var_expr);
 
       [[nodiscard]] auto to_string() const -> std::string override;
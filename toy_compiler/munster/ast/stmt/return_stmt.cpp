@@ -3,7 +3,7 @@
 namespace munster::ast
 {
    return_stmt::return_stmt(node_ptr value, node_ptr expr) :
-      stmt{std::string{value->lexeme()}, value->location()}
+      stmt{static_kind, std::string{value->lexeme()}, value->location()}
    {
       make_child(std::move(expr));
    }
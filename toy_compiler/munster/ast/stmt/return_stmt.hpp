@@ -7,6 +7,8 @@ namespace munster::ast
    class return_stmt : public stmt
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_return_stmt;
+
       return_stmt(node_ptr value, node_ptr expr);
 
       [[nodiscard]] auto to_string() const -> std::string override;
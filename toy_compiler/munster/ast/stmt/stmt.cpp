@@ -2,9 +2,16 @@
 
 namespace munster::ast
 {
-   stmt::stmt(const source_location& location) : node{location} {}
-   stmt::stmt(const std::string& lexeme, const source_location& location) : node{lexeme, location}
+   stmt::stmt(node_kind kind) : node{kind} {}
+   stmt::stmt(node_kind kind, const source_location& location) : node{kind, location} {}
+   stmt::stmt(node_kind kind, std::string_view lexeme, const source_location& location) :
+      node{kind, lexeme, location}
    {}
 
-   void stmt::accept(visitor_variant& /*visitor*/) const {}
+   auto stmt::enter(visitor_group /*visitors*/) const -> traversal_action
+   {
+      return traversal_action::e_skip_children;
+   }
+
+   void stmt::leave(visitor_group /*visitors*/) const {}
 } // namespace munster::ast
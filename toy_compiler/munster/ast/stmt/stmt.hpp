@@ -7,11 +7,16 @@ namespace munster::ast
    class stmt : public node
    {
    public:
-      stmt() = default;
-      stmt(const source_location& location);
-      stmt(const std::string& lexeme, const source_location& location);
+      static constexpr node_kind first_kind = node_kind::e_assign_stmt;
+      static constexpr node_kind last_kind = node_kind::e_write_stmt;
 
-      void accept(visitor_variant& visitor) const override;
+   public:
+      stmt(node_kind kind);
+      stmt(node_kind kind, const source_location& location);
+      stmt(node_kind kind, std::string_view lexeme, const source_location& location);
+
+      [[nodiscard]] auto enter(visitor_group visitors) const -> traversal_action override;
+      void leave(visitor_group visitors) const override;
 
       [[nodiscard]] auto to_string() const -> std::string override = 0;
    };
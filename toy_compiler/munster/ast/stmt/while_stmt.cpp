@@ -5,24 +5,22 @@
 
 namespace munster::ast
 {
-   while_stmt::while_stmt(node_ptr loc, node_ptr expr, node_ptr stmt_block) : stmt{loc->location()}
+   while_stmt::while_stmt(node_ptr loc, node_ptr expr, node_ptr stmt_block) :
+      stmt{static_kind, loc->location()}
    {
-      assert(detail::is_type<location_decl>(loc)); // NOLINT
+      assert(isa<location_decl>(loc)); // NOLINT
 
       make_child(std::move(expr));
       make_child(std::move(stmt_block));
    }
 
-   void while_stmt::accept(visitor_variant& visitor) const
+   auto while_stmt::enter(visitor_group /*visitors*/) const -> traversal_action
    {
-      for (const auto& child : children())
-      {
-         child->accept(visitor);
-      }
-
-      visit_node(visitor, *this);
+      return traversal_action::e_continue;
    }
 
+   void while_stmt::leave(visitor_group visitors) const { visit_node(visitors, *this); }
+
    auto while_stmt::to_string() const -> std::string
    {
       return fmt::format("while_stmt <line:{}, col:{}>", location().line, location().column);
@@ -7,6 +7,8 @@ namespace munster::ast
    class write_stmt : public stmt
    {
    public:
+      static constexpr node_kind static_kind = node_kind::e_write_stmt;
+
       write_stmt(node_ptr value, node_ptr expr);
 
       [[nodiscard]] auto to_string() const -> std::string override;
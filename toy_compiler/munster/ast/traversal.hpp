@@ -0,0 +1,126 @@
+#pragma once
+
+#include <toy_compiler/munster/ast/node.hpp>
+
+#include <concepts>
+#include <cstdint>
+#include <vector>
+
+namespace munster::ast
+{
+   /**
+    * @brief The moment at which a walk hands a node over to its caller
+    */
+   enum struct traversal_event : std::uint8_t
+   {
+      e_enter, // before the children of the node
+      e_leave  // after the children of the node
+   };
+
+   /**
+    * @brief Walk the tree rooted at `root` depth first, calling `fn(node, event, depth)` once when
+    * entering every node and once when leaving it. The walk uses a stack allocated on the heap
+    * instead of recursing, so the native stack used is the same whatever the depth of the tree.
+    * Null children are skipped over
+    *
+    * @param[in] root The node to start the walk from, at a depth of 0
+    * @param[in] fn The callback. The `traversal_action` it returns when entering a node tells the
+    * walk whether to go through the children of the node, a node whose children are skipped is
+    * still left. Returning `traversal_action::e_stop` from either event ends the walk
+    *
+    * @return false if the walk was stopped before reaching the end of the tree
+    */
+   template <typename Fn>
+      requires std::invocable<Fn&, const node&, traversal_event, std::size_t>
+   auto walk(const node& root, Fn&& fn) -> bool
+   {
+      struct frame
+      {
+         const node* p_node;
+         std::size_t next_child;
+      };
+
+      const auto push = [&](const node& n, std::vector<frame>& stack) -> bool {
+         const auto action = fn(n, traversal_event::e_enter, std::size(stack));
+         if (action == traversal_action::e_stop)
+         {
+            return false;
+         }
+
+         const auto next_child =
+            action == traversal_action::e_skip_children ? std::size(n.children()) : 0;
+         stack.push_back(frame{.p_node = &n, .next_child = next_child});
+
+         return true;
+      };
+
+      std::vector<frame> stack;
+      if (!push(root, stack))
+      {
+         return false;
+      }
+
+      while (!std::empty(stack))
+      {
+         auto& top = stack.back();
+         const auto& children = top.p_node->children();
+
+         if (top.next_child < std::size(children))
+         {
+            const auto* p_child = children[top.next_child++].get();
+            if (p_child && !push(*p_child, stack))
+            {
+               return false;
+            }
+         }
+         else
+         {
+            const node& current = *top.p_node;
+            stack.pop_back();
+
+            if (fn(current, traversal_event::e_leave, std::size(stack)) == traversal_action::e_stop)
+            {
+               return false;
+            }
+         }
+      }
+
+      return true;
+   }
+
+   /**
+    * @brief Walk the tree rooted at `root`, calling `fn(node, depth)` on every node before its
+    * children. See `ast::walk`
+    */
+   template <typename Fn>
+      requires std::invocable<Fn&, const node&, std::size_t>
+   auto pre_order(const node& root, Fn&& fn) -> bool
+   {
+      return walk(root, [&](const node& n, traversal_event event, std::size_t depth) {
+         if (event == traversal_event::e_enter)
+         {
+            return fn(n, depth);
+         }
+
+         return traversal_action::e_continue;
+      });
+   }
+
+   /**
+    * @brief Walk the tree rooted at `root`, calling `fn(node, depth)` on every node after its
+    * children. See `ast::walk`
+    */
+   template <typename Fn>
+      requires std::invocable<Fn&, const node&, std::size_t>
+   auto post_order(const node& root, Fn&& fn) -> bool
+   {
+      return walk(root, [&](const node& n, traversal_event event, std::size_t depth) {
+         if (event == traversal_event::e_leave)
+         {
+            return fn(n, depth);
+         }
+
+         return traversal_action::e_continue;
+      });
+   }
+} // namespace munster::ast
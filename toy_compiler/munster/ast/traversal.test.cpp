@@ -0,0 +1,154 @@
+/**
+ * @brief Runs tests on functions defined in traversal.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ast/stmt/break_stmt.hpp>
+#include <toy_compiler/munster/ast/stmt/compound_stmt.hpp>
+#include <toy_compiler/munster/ast/stmt/continue_stmt.hpp>
+#include <toy_compiler/munster/ast/traversal.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace munster::ast;
+
+namespace
+{
+   auto make_leaf(arena& arena, node_kind kind) -> node_ptr
+   {
+      if (kind == node_kind::e_break_stmt)
+      {
+         return arena.make<break_stmt>("break", munster::source_location{});
+      }
+
+      return arena.make<continue_stmt>("continue", munster::source_location{});
+   }
+
+   auto make_compound(arena& arena, std::vector<node_ptr>&& statements) -> node_ptr
+   {
+      return arena.make<compound_stmt>(std::move(statements));
+   }
+} // namespace
+
+TEST_SUITE("Traversal test suite")
+{
+   TEST_CASE("walk")
+   {
+      arena arena;
+
+      // compound { compound { break }, continue }
+      std::vector<node_ptr> inner;
+      inner.push_back(make_leaf(arena, node_kind::e_break_stmt));
+
+      std::vector<node_ptr> outer;
+      outer.push_back(make_compound(arena, std::move(inner)));
+      outer.push_back(make_leaf(arena, node_kind::e_continue_stmt));
+
+      const node_ptr root = make_compound(arena, std::move(outer));
+
+      SUBCASE("pre order")
+      {
+         std::vector<node_kind> kinds;
+         std::vector<std::size_t> depths;
+         CHECK(pre_order(*root, [&](const node& n, std::size_t depth) {
+            kinds.push_back(n.kind());
+            depths.push_back(depth);
+
+            return traversal_action::e_continue;
+         }));
+
+         CHECK(kinds ==
+               std::vector{node_kind::e_compound_stmt, node_kind::e_compound_stmt,
+                           node_kind::e_break_stmt, node_kind::e_continue_stmt});
+         CHECK(depths == std::vector<std::size_t>{0, 1, 2, 1});
+      }
+      SUBCASE("post order")
+      {
+         std::vector<node_kind> kinds;
+         std::vector<std::size_t> depths;
+         CHECK(post_order(*root, [&](const node& n, std::size_t depth) {
+            kinds.push_back(n.kind());
+            depths.push_back(depth);
+
+            return traversal_action::e_continue;
+         }));
+
+         CHECK(kinds ==
+               std::vector{node_kind::e_break_stmt, node_kind::e_compound_stmt,
+                           node_kind::e_continue_stmt, node_kind::e_compound_stmt});
+         CHECK(depths == std::vector<std::size_t>{2, 1, 1, 0});
+      }
+      SUBCASE("skip children")
+      {
+         std::vector<traversal_event> events;
+         CHECK(walk(*root, [&](const node& n, traversal_event event, std::size_t depth) {
+            events.push_back(event);
+
+            return depth == 1 && isa<compound_stmt>(n) ? traversal_action::e_skip_children
+                                                       : traversal_action::e_continue;
+         }));
+
+         CHECK(events ==
+               std::vector{traversal_event::e_enter, traversal_event::e_enter,
+                           traversal_event::e_leave, traversal_event::e_enter,
+                           traversal_event::e_leave, traversal_event::e_leave});
+      }
+      SUBCASE("stop")
+      {
+         std::vector<node_kind> kinds;
+         CHECK_FALSE(pre_order(*root, [&](const node& n, std::size_t /*depth*/) {
+            kinds.push_back(n.kind());
+
+            return isa<break_stmt>(n) ? traversal_action::e_stop : traversal_action::e_continue;
+         }));
+
+         CHECK(kinds ==
+               std::vector{node_kind::e_compound_stmt, node_kind::e_compound_stmt,
+                           node_kind::e_break_stmt});
+      }
+   }
+   TEST_CASE("deep trees")
+   {
+      constexpr std::size_t depth = 1U << 20U;
+
+      arena arena;
+
+      node_ptr root = make_leaf(arena, node_kind::e_break_stmt);
+      for (std::size_t i = 0; i < depth; ++i)
+      {
+         std::vector<node_ptr> statements;
+         statements.push_back(std::move(root));
+
+         root = make_compound(arena, std::move(statements));
+      }
+
+      std::size_t count = 0;
+      std::size_t max_depth = 0;
+      CHECK(post_order(*root, [&](const node& /*n*/, std::size_t d) {
+         ++count;
+         max_depth = std::max(max_depth, d);
+
+         return traversal_action::e_continue;
+      }));
+
+      CHECK(count == depth + 1);
+      CHECK(max_depth == depth);
+   }
+}
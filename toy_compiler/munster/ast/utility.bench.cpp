@@ -0,0 +1,164 @@
+/**
+ * @file utility.bench.cpp
+ * @brief Measures the rate at which visit_node, defined in utility.hpp, dispatches nodes to the
+ * visitors
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/ast/arena.hpp>
+#include <toy_compiler/munster/ast/stmt/break_stmt.hpp>
+#include <toy_compiler/munster/ast/stmt/continue_stmt.hpp>
+#include <toy_compiler/munster/ast/utility.hpp>
+
+#include <fmt/core.h>
+
+#include <mpark/patterns.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace munster;
+
+namespace
+{
+   constexpr std::size_t node_count = 1U << 16U;
+   constexpr std::size_t visitor_count = 64;
+   constexpr std::size_t round_count = 16;
+
+   /**
+    * @brief The dispatch `ast::visit_node` used before the table: a pattern match over the
+    * alternatives of the variant
+    */
+   template <typename Any>
+   void match_visit_node(ast::visitor_variant& visitor, const Any& node)
+   {
+      using namespace mpark::patterns;
+
+      const auto visit = [&](auto& vis) {
+         vis(node);
+      };
+
+      match(visitor)(pattern(as<symbol_table_visitor>(arg)) = visit,
+                     pattern(as<memory_size_visitor>(arg)) = visit,
+                     pattern(as<type_checking_visitor>(arg)) = visit,
+                     pattern(as<code_gen_visitor>(arg)) = visit);
+   }
+
+   /**
+    * @brief The best time, in nanoseconds, taken by `fn` to visit every node with a visitor picked
+    * pseudo randomly, so the alternative held by the variant can't be predicted
+    */
+   template <typename Fn>
+   auto measure(std::span<const ast::node_ptr> nodes, std::span<ast::visitor_variant> visitors,
+                Fn fn) -> std::int64_t
+   {
+      auto best = std::numeric_limits<std::int64_t>::max();
+      for (std::size_t round = 0; round < round_count; ++round)
+      {
+         std::uint32_t state = 0x9e3779b9U; // NOLINT
+
+         const auto start = std::chrono::steady_clock::now();
+         for (const auto& node : nodes)
+         {
+            state ^= state << 13U; // NOLINT
+            state ^= state >> 17U; // NOLINT
+            state ^= state << 5U;  // NOLINT
+
+            fn(visitors[state % std::size(visitors)], *node);
+         }
+         const auto end = std::chrono::steady_clock::now();
+
+         best = std::min<std::int64_t>(
+            best, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+      }
+
+      return best;
+   }
+
+   /**
+    * @brief Calls the visitor on the concrete type of the node, both benchmarked nodes have a
+    * visit that does nothing in the symbol table & memory size visitors
+    */
+   template <typename Dispatch>
+   auto visit_leaf(Dispatch dispatch)
+   {
+      return [=](ast::visitor_variant& visitor, const ast::node& node) {
+         if (const auto* p_break = ast::dyn_cast<ast::break_stmt>(&node))
+         {
+            dispatch(visitor, *p_break);
+         }
+         else
+         {
+            dispatch(visitor, ast::cast<ast::continue_stmt>(node));
+         }
+      };
+   }
+} // namespace
+
+auto main() -> int
+{
+   ast::arena arena{};
+
+   std::vector<ast::node_ptr> nodes;
+   nodes.reserve(node_count);
+   for (std::size_t i = 0; i < node_count; ++i)
+   {
+      if (i % 2 == 0)
+      {
+         nodes.push_back(arena.make<ast::break_stmt>("break", source_location{}));
+      }
+      else
+      {
+         nodes.push_back(arena.make<ast::continue_stmt>("continue", source_location{}));
+      }
+   }
+
+   std::vector<ast::visitor_variant> visitors;
+   visitors.reserve(visitor_count);
+   for (std::size_t i = 0; i < visitor_count; ++i)
+   {
+      if (i % 2 == 0)
+      {
+         visitors.emplace_back(symbol_table_visitor{});
+      }
+      else
+      {
+         visitors.emplace_back(memory_size_visitor{nullptr});
+      }
+   }
+
+   const auto matched = measure(nodes, visitors, visit_leaf([](auto& visitor, const auto& node) {
+                                   match_visit_node(visitor, node);
+                                }));
+   const auto tabled = measure(nodes, visitors, visit_leaf([](auto& visitor, const auto& node) {
+                                  ast::visit_node(visitor, node);
+                               }));
+
+   const auto rate = [](std::int64_t ns) {
+      return static_cast<double>(node_count) * 1e3 / static_cast<double>(ns); // NOLINT
+   };
+
+   fmt::print("{} nodes, best of {} rounds\n", node_count, round_count);
+   fmt::print("pattern match  : {:8.2f} Mvisits/s\n", rate(matched));
+   fmt::print("dispatch table : {:8.2f} Mvisits/s\n", rate(tabled));
+   fmt::print("speedup        : {:8.2f}x\n",
+              static_cast<double>(matched) / static_cast<double>(tabled));
+
+   return 0;
+}
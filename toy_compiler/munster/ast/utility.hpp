@@ -2,22 +2,55 @@
 
 #include <toy_compiler/munster/ast/node.hpp>
 
-#include <mpark/patterns.hpp>
+#include <array>
+#include <cassert>
+#include <utility>
+#include <variant>
 
 namespace munster::ast
 {
+   namespace detail
+   {
+      template <typename Any, std::size_t Index>
+      void visit_alternative(visitor_variant& visitor, const Any& node)
+      {
+         (*std::get_if<Index>(&visitor))(node);
+      }
+
+      template <typename Any, std::size_t... Indices>
+      consteval auto make_dispatch_table(std::index_sequence<Indices...>)
+      {
+         return std::array{&visit_alternative<Any, Indices>...};
+      }
+
+      /**
+       * @brief One entry per alternative of the `visitor_variant`, each calling the visitor held
+       * by the variant on a node of type `Any`
+       */
+      template <typename Any>
+      inline constexpr auto dispatch_table = make_dispatch_table<Any>(
+         std::make_index_sequence<std::variant_size_v<visitor_variant>>{});
+   } // namespace detail
+
+   /**
+    * @brief Call the visitor held by `visitor` on `node`. The visitor is picked through a table
+    * generated at compile time for the type of the node, indexed by the active alternative of the
+    * variant, so a visit costs a single indirect call
+    */
    template <typename Any>
    void visit_node(visitor_variant& visitor, const Any& node)
    {
-      using namespace mpark::patterns;
+      assert(!visitor.valueless_by_exception()); // NOLINT
 
-      const auto visit = [&](auto& vis) {
-         vis(node);
-      };
+      detail::dispatch_table<Any>[visitor.index()](visitor, node);
+   }
 
-      match(visitor)(pattern(as<symbol_table_visitor>(arg)) = visit,
-                     pattern(as<memory_size_visitor>(arg)) = visit,
-                     pattern(as<type_checking_visitor>(arg)) = visit,
-                     pattern(as<code_gen_visitor>(arg)) = visit);
+   template <typename Any>
+   void visit_node(visitor_group visitors, const Any& node)
+   {
+      for (auto& visitor : visitors)
+      {
+         visit_node(visitor, node);
+      }
    }
 } // namespace munster::ast
@@ -19,6 +19,10 @@
 
 #include <toy_compiler/munster/grammar/production_table.hpp>
 
+#include <range/v3/view/reverse.hpp>
+
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 namespace munster::grammar
@@ -46,9 +50,13 @@ namespace munster::grammar
       m_data.at(col).at(row) = production{key.first, std::move(tail), nullable}; // NOLINT
    }
 
-   auto construct_production_table() -> const grammar::production_table
+   /**
+    * @brief Give every production of the LL(1) grammar (resources/grammar/grammar_LL(1)_action.grm)
+    * to `table` through its `set_production` function. May be evaluated at compile time
+    */
+   template <typename Table>
+   constexpr void define_productions(Table& table)
    {
-      production_table table{};
       symbol_array epsilon = {token_type::e_epsilon};
 
       // <AddOp>
@@ -795,6 +803,142 @@ namespace munster::grammar
                               {token_type::e_private, action::e_visibily_decl});
       }
 
+   }
+
+   /**
+    * @brief Records the productions given by `define_productions` in the layout of the
+    * precompiled table. Identical productions are only stored once
+    */
+   class production_recorder
+   {
+   public:
+      constexpr void set_production(const production_table::key& key, const symbol_array& tail,
+                                    nullable_t = nullable_t{false})
+      {
+         std::vector<packed_symbol> symbols;
+         for (const auto& symbol : tail | ranges::views::reverse)
+         {
+            if (symbol != token_type::e_epsilon)
+            {
+               symbols.push_back(pack(symbol));
+            }
+         }
+
+         std::size_t index = 0;
+         while (index < std::size(m_productions) && !is_same(m_productions[index], key.first,
+                                                             symbols))
+         {
+            ++index;
+         }
+
+         if (index == std::size(m_productions))
+         {
+            m_productions.push_back({.start = key.first,
+                                     .offset = static_cast<std::uint16_t>(std::size(m_pool)),
+                                     .length = static_cast<std::uint16_t>(std::size(symbols))});
+            m_pool.insert(std::end(m_pool), std::begin(symbols), std::end(symbols));
+         }
+
+         const auto col = static_cast<std::size_t>(key.second);
+         const auto row = static_cast<std::size_t>(key.first);
+
+         m_cells[col * precompiled_height + row] = static_cast<std::uint16_t>(index + 1);
+      }
+
+      [[nodiscard]] constexpr auto cells() const -> const std::vector<std::uint16_t>&
+      {
+         return m_cells;
+      }
+      [[nodiscard]] constexpr auto productions() const -> const std::vector<precompiled_production>&
+      {
+         return m_productions;
+      }
+      [[nodiscard]] constexpr auto pool() const -> const std::vector<packed_symbol>&
+      {
+         return m_pool;
+      }
+
+   private:
+      [[nodiscard]] constexpr auto is_same(const precompiled_production& production,
+                                           grammar_type start,
+                                           const std::vector<packed_symbol>& symbols) const -> bool
+      {
+         return production.start == start && production.length == std::size(symbols) &&
+            std::equal(std::begin(symbols), std::end(symbols),
+                       std::begin(m_pool) + production.offset);
+      }
+
+   private:
+      std::vector<std::uint16_t> m_cells =
+         std::vector<std::uint16_t>(precompiled_width * precompiled_height);
+      std::vector<precompiled_production> m_productions;
+      std::vector<packed_symbol> m_pool;
+   };
+
+   constexpr auto record_productions() -> production_recorder
+   {
+      production_recorder recorder;
+      define_productions(recorder);
+
+      return recorder;
+   }
+
+   constexpr std::size_t production_count = std::size(record_productions().productions());
+   constexpr std::size_t pool_size = std::size(record_productions().pool());
+
+   static_assert(production_count < std::numeric_limits<std::uint16_t>::max(),
+                 "the index of a production must fit in a cell of the table");
+
+   /**
+    * @brief The production table of the LL(1) grammar, generated at compile time.
+    *
+    * Every cell holds the index, plus one, of its production in `productions` or 0 if there is
+    * none. The symbols of all productions are stored contiguously in `pool`.
+    */
+   struct precompiled_table
+   {
+      std::array<std::uint16_t, precompiled_width * precompiled_height> cells{};
+      std::array<precompiled_production, production_count> productions{};
+      std::array<packed_symbol, pool_size> pool{};
+   };
+
+   constexpr auto make_precompiled_table() -> precompiled_table
+   {
+      const auto recorder = record_productions();
+
+      precompiled_table table{};
+      std::ranges::copy(recorder.cells(), std::begin(table.cells));
+      std::ranges::copy(recorder.productions(), std::begin(table.productions));
+      std::ranges::copy(recorder.pool(), std::begin(table.pool));
+
       return table;
    }
+
+   constexpr auto precompiled = make_precompiled_table();
+
+   auto construct_production_table() -> const grammar::production_table
+   {
+      production_table table{};
+      define_productions(table);
+
+      return table;
+   }
+
+   auto lookup_precompiled(const production_table::key& k) -> const precompiled_production*
+   {
+      const auto col = static_cast<std::size_t>(k.second);
+      const auto row = static_cast<std::size_t>(k.first);
+
+      const auto cell = precompiled.cells[col * precompiled_height + row]; // NOLINT
+      if (cell == 0)
+      {
+         return nullptr;
+      }
+
+      return &precompiled.productions[cell - 1U]; // NOLINT
+   }
+   auto stack_symbols(const precompiled_production& production) -> std::span<const packed_symbol>
+   {
+      return std::span{precompiled.pool}.subspan(production.offset, production.length);
+   }
 } // namespace munster::grammar
@@ -23,6 +23,8 @@
 #include <toy_compiler/munster/grammar/symbol.hpp>
 
 #include <array>
+#include <span>
+#include <vector>
 
 namespace munster::grammar
 {
@@ -73,4 +75,32 @@ namespace munster::grammar
    };
 
    auto construct_production_table() -> const grammar::production_table;
+
+   constexpr std::size_t precompiled_width = static_cast<std::size_t>(token_type::e_max_size);
+   constexpr std::size_t precompiled_height = static_cast<std::size_t>(grammar_type::max_size);
+
+   /**
+    * @brief A production of the precompiled LL(1) table. Its symbols are packed & stored in the
+    * order they are pushed on the parse stack: reversed & without epsilons
+    */
+   struct precompiled_production
+   {
+      grammar_type start{grammar_type::max_size};
+      std::uint16_t offset{};
+      std::uint16_t length{};
+   };
+
+   /**
+    * @brief Access the production of the LL(1) grammar associated with a certain
+    * `production_table::key` in the table generated at compile time.
+    *
+    * @param[in] k The `production_table::key` to access the production
+    *
+    * @return The production, or nullptr if the table has no production for `k`
+    */
+   auto lookup_precompiled(const production_table::key& k) -> const precompiled_production*;
+   /**
+    * @brief Access the symbols to push on the parse stack when applying a precompiled production
+    */
+   auto stack_symbols(const precompiled_production& production) -> std::span<const packed_symbol>;
 } // namespace munster::grammar
@@ -44,6 +44,26 @@ constexpr auto to_key(std::tuple<std::uint32_t, std::uint32_t> t)
            to<munster::grammar::token_type>(std::get<1>(t))};
 }
 
+/**
+ * @brief The symbols pushed on the parse stack for a tail: packed, reversed & without epsilons
+ */
+auto to_stack_symbols(const munster::grammar::symbol_array& tail)
+   -> std::vector<munster::grammar::packed_symbol>
+{
+   using namespace munster::grammar;
+
+   std::vector<packed_symbol> symbols;
+   for (auto it = std::rbegin(tail); it != std::rend(tail); ++it)
+   {
+      if (*it != token_type::e_epsilon)
+      {
+         symbols.push_back(pack(*it));
+      }
+   }
+
+   return symbols;
+}
+
 auto create_table() -> munster::grammar::production_table
 {
    using namespace munster::grammar;
@@ -178,4 +198,36 @@ TEST_SUITE("grammar/symbol_table.hpp test suite")
          CHECK(std::size(table.lookup(k).tail()) == 5);
       }
    }
+   TEST_CASE("lookup_precompiled()")
+   {
+      using namespace munster::grammar;
+
+      namespace vi = ranges::views;
+
+      const auto grammar_size =
+         static_cast<std::uint32_t>(munster::grammar::grammar_type::max_size);
+      const auto token_size = static_cast<std::uint32_t>(munster::grammar::token_type::e_max_size);
+
+      const production_table table = construct_production_table();
+
+      const auto all_keys =
+         vi::cartesian_product(vi::iota(0u, grammar_size), vi::iota(0u, token_size)) |
+         vi::transform(to_key);
+
+      for (const auto k : all_keys)
+      {
+         const auto* p_production = lookup_precompiled(k);
+         if (table.lookup(k) == production{})
+         {
+            CHECK(p_production == nullptr);
+         }
+         else
+         {
+            REQUIRE(p_production != nullptr);
+            CHECK(p_production->start == k.first);
+            CHECK(ranges::to_vector(stack_symbols(*p_production)) ==
+                  to_stack_symbols(table.lookup(k).tail()));
+         }
+      }
+   }
 }
@@ -247,6 +247,150 @@ namespace munster::grammar
    }
 
    constexpr auto get_action_type(const symbol& s) -> action { return get<symbol_type::action>(s); }
+
+   /**
+    * @brief A `grammar::symbol` packed into 16 bits, used by the parse stack.
+    *
+    * The `grammar::symbol_type` is stored in the 4 high bits & the value of the enum in the 12 low
+    * bits, so that checking the type of a symbol or comparing it to a `grammar::token_type` is
+    * a mask & an integer comparison.
+    */
+   using packed_symbol = std::uint16_t;
+
+   namespace detail
+   {
+      constexpr std::uint32_t packed_type_shift = 12;
+      constexpr std::uint32_t packed_value_mask = (1U << packed_type_shift) - 1;
+      constexpr std::uint32_t packed_type_mask = ~packed_value_mask & 0xFFFFU; // NOLINT
+
+      constexpr auto pack(symbol_type type, std::uint32_t value) -> packed_symbol
+      {
+         return static_cast<packed_symbol>((static_cast<std::uint32_t>(type) << packed_type_shift) |
+                                           value);
+      }
+      constexpr auto packed_type(packed_symbol s) -> std::uint32_t
+      {
+         return s & packed_type_mask;
+      }
+      constexpr auto packed_value(packed_symbol s) -> std::uint32_t
+      {
+         return s & packed_value_mask;
+      }
+
+      static_assert(static_cast<std::uint32_t>(token_type::e_max_size) <= packed_value_mask);
+      static_assert(static_cast<std::uint32_t>(grammar_type::max_size) <= packed_value_mask);
+      static_assert(static_cast<std::uint32_t>(action::e_epsilon) <= packed_value_mask);
+   } // namespace detail
+
+   /**
+    * @brief Pack a `grammar::token_type` value as a terminal `grammar::packed_symbol`
+    */
+   constexpr auto pack(token_type value) -> packed_symbol
+   {
+      return detail::pack(symbol_type::terminal, static_cast<std::uint32_t>(value));
+   }
+   /**
+    * @brief Pack a `grammar::grammar_type` value as a non terminal `grammar::packed_symbol`
+    */
+   constexpr auto pack(grammar_type value) -> packed_symbol
+   {
+      return detail::pack(symbol_type::non_terminal, static_cast<std::uint32_t>(value));
+   }
+   /**
+    * @brief Pack a `grammar::action` value as an action `grammar::packed_symbol`
+    */
+   constexpr auto pack(action value) -> packed_symbol
+   {
+      return detail::pack(symbol_type::action, static_cast<std::uint32_t>(value));
+   }
+   /**
+    * @brief Pack any `grammar::symbol` into a `grammar::packed_symbol`
+    */
+   constexpr auto pack(const symbol& s) -> packed_symbol
+   {
+      switch (s.type())
+      {
+         case symbol_type::terminal:
+            return pack(get<symbol_type::terminal>(s));
+         case symbol_type::non_terminal:
+            return pack(get<symbol_type::non_terminal>(s));
+         case symbol_type::action:
+            return pack(get<symbol_type::action>(s));
+         default:
+            return detail::pack(symbol_type::stop, 0);
+      }
+   }
+
+   /**
+    * @brief The `grammar::packed_symbol` of `grammar::symbol::stop()`
+    */
+   constexpr packed_symbol packed_stop = detail::pack(symbol_type::stop, 0);
+
+   /**
+    * @brief Get the `grammar::symbol_type` of a `grammar::packed_symbol`
+    */
+   constexpr auto get_symbol_type(packed_symbol s) -> symbol_type
+   {
+      return static_cast<symbol_type>(detail::packed_type(s) >> detail::packed_type_shift);
+   }
+   constexpr auto is_stop(packed_symbol s) -> bool { return s == packed_stop; }
+   constexpr auto is_terminal(packed_symbol s) -> bool
+   {
+      return detail::packed_type(s) == detail::packed_type(pack(token_type{}));
+   }
+   constexpr auto is_non_terminal(packed_symbol s) -> bool
+   {
+      return detail::packed_type(s) == detail::packed_type(pack(grammar_type{}));
+   }
+   constexpr auto is_action(packed_symbol s) -> bool
+   {
+      return detail::packed_type(s) == detail::packed_type(pack(action{}));
+   }
+
+   /**
+    * @brief Access the `grammar::token_type` value of a terminal `grammar::packed_symbol`
+    */
+   constexpr auto get_token_type(packed_symbol s) -> token_type
+   {
+      return static_cast<token_type>(detail::packed_value(s));
+   }
+   /**
+    * @brief Access the `grammar::grammar_type` value of a non terminal `grammar::packed_symbol`
+    */
+   constexpr auto get_grammar_type(packed_symbol s) -> grammar_type
+   {
+      return static_cast<grammar_type>(detail::packed_value(s));
+   }
+   /**
+    * @brief Access the `grammar::action` value of an action `grammar::packed_symbol`
+    */
+   constexpr auto get_action_type(packed_symbol s) -> action
+   {
+      return static_cast<action>(detail::packed_value(s));
+   }
+
+   /**
+    * @brief Convert a `grammar::packed_symbol` back into a `grammar::symbol`
+    */
+   constexpr auto unpack(packed_symbol s) -> symbol
+   {
+      if (is_terminal(s))
+      {
+         return get_token_type(s);
+      }
+
+      if (is_non_terminal(s))
+      {
+         return get_grammar_type(s);
+      }
+
+      if (is_action(s))
+      {
+         return get_action_type(s);
+      }
+
+      return symbol::stop();
+   }
 } // namespace munster::grammar
 
 /**
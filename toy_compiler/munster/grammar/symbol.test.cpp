@@ -222,6 +222,58 @@ TEST_SUITE("grammar/symbol.hpp test suite")
          CHECK_FALSE(is_stop(symbol::terminal()));
       }
    }
+   TEST_CASE("packed_symbol")
+   {
+      using ranges::views::iota;
+
+      SUBCASE("terminal")
+      {
+         for (std::uint32_t i : iota(0u, static_cast<std::uint32_t>(token_type::e_max_size)))
+         {
+            const auto packed = pack(symbol{static_cast<token_type>(i)});
+
+            CHECK(is_terminal(packed));
+            CHECK_FALSE(is_non_terminal(packed));
+            CHECK_FALSE(is_action(packed));
+            CHECK_FALSE(is_stop(packed));
+            CHECK(get_symbol_type(packed) == symbol_type::terminal);
+            CHECK(get_token_type(packed) == static_cast<token_type>(i));
+            CHECK(packed == pack(static_cast<token_type>(i)));
+            CHECK(unpack(packed) == symbol{static_cast<token_type>(i)});
+         }
+      }
+      SUBCASE("non_terminal")
+      {
+         for (std::uint32_t i : iota(0u, static_cast<std::uint32_t>(grammar_type::max_size)))
+         {
+            const auto packed = pack(symbol{static_cast<grammar_type>(i)});
+
+            CHECK_FALSE(is_terminal(packed));
+            CHECK(is_non_terminal(packed));
+            CHECK_FALSE(is_action(packed));
+            CHECK_FALSE(is_stop(packed));
+            CHECK(get_symbol_type(packed) == symbol_type::non_terminal);
+            CHECK(get_grammar_type(packed) == static_cast<grammar_type>(i));
+            CHECK(unpack(packed) == symbol{static_cast<grammar_type>(i)});
+         }
+      }
+      SUBCASE("action")
+      {
+         const auto packed = pack(symbol{action::e_epsilon});
+
+         CHECK(is_action(packed));
+         CHECK(get_symbol_type(packed) == symbol_type::action);
+         CHECK(get_action_type(packed) == action::e_epsilon);
+         CHECK(unpack(packed) == symbol{action::e_epsilon});
+      }
+      SUBCASE("stop")
+      {
+         CHECK(pack(symbol::stop()) == packed_stop);
+         CHECK(is_stop(packed_stop));
+         CHECK(get_symbol_type(packed_stop) == symbol_type::stop);
+         CHECK(unpack(packed_stop) == symbol::stop());
+      }
+   }
 
    TEST_CASE("to_string_view()")
    {
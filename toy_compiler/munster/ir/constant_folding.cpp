@@ -0,0 +1,304 @@
+/**
+ * @file constant_folding.cpp
+ * @brief Implement the functions defined at constant_folding.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/ir/constant_folding.hpp>
+
+#include <toy_compiler/util/flat_hash_map.hpp>
+
+#include <charconv>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace munster::ir
+{
+   namespace
+   {
+      constexpr std::int32_t min_immediate = std::numeric_limits<std::int16_t>::min();
+      constexpr std::int32_t max_immediate = std::numeric_limits<std::int16_t>::max();
+
+      auto fits_immediate(std::int32_t value) -> bool
+      {
+         return value >= min_immediate && value <= max_immediate;
+      }
+
+      /**
+       * @brief The integer written in `text`, if all of it is an integer that fits in an
+       * immediate
+       */
+      auto parse_immediate(std::string_view text) -> std::optional<std::int32_t>
+      {
+         std::int32_t value = 0;
+         const auto* p_end = text.data() + std::size(text);
+         const auto [p_last, error] = std::from_chars(text.data(), p_end, value);
+         if (error != std::errc{} || p_last != p_end || !fits_immediate(value))
+         {
+            return std::nullopt;
+         }
+
+         return value;
+      }
+
+      /**
+       * @brief Compute `lhs op rhs` on 32 bit words, wrapping on overflow
+       */
+      auto evaluate(opcode op, std::int32_t lhs, std::int32_t rhs) -> std::optional<std::int32_t>
+      {
+         const auto wrap = [](std::int64_t value) {
+            return static_cast<std::int32_t>(static_cast<std::uint32_t>(value));
+         };
+
+         switch (op)
+         {
+            case opcode::e_add:
+               return wrap(std::int64_t{lhs} + rhs);
+            case opcode::e_sub:
+               return wrap(std::int64_t{lhs} - rhs);
+            case opcode::e_mul:
+               return wrap(std::int64_t{lhs} * rhs);
+            case opcode::e_div:
+               if (rhs == 0)
+               {
+                  return std::nullopt;
+               }
+               return wrap(std::int64_t{lhs} / rhs);
+            case opcode::e_or:
+               return lhs | rhs;
+            case opcode::e_and:
+               return lhs & rhs;
+            case opcode::e_eq:
+               return static_cast<std::int32_t>(lhs == rhs);
+            case opcode::e_ne:
+               return static_cast<std::int32_t>(lhs != rhs);
+            case opcode::e_lt:
+               return static_cast<std::int32_t>(lhs < rhs);
+            case opcode::e_gt:
+               return static_cast<std::int32_t>(lhs > rhs);
+            case opcode::e_le:
+               return static_cast<std::int32_t>(lhs <= rhs);
+            case opcode::e_ge:
+               return static_cast<std::int32_t>(lhs >= rhs);
+            default:
+               return std::nullopt;
+         }
+      }
+
+      /**
+       * @brief The operation giving the same result once its operands are swapped, if there is
+       * one
+       */
+      auto swapped(opcode op) -> std::optional<opcode>
+      {
+         switch (op)
+         {
+            case opcode::e_add:
+            case opcode::e_mul:
+            case opcode::e_or:
+            case opcode::e_and:
+            case opcode::e_eq:
+            case opcode::e_ne:
+               return op;
+            case opcode::e_lt:
+               return opcode::e_gt;
+            case opcode::e_gt:
+               return opcode::e_lt;
+            case opcode::e_le:
+               return opcode::e_ge;
+            case opcode::e_ge:
+               return opcode::e_le;
+            default:
+               return std::nullopt;
+         }
+      }
+
+      void load_constant(instruction& instr, std::int32_t value)
+      {
+         instr = {.op = opcode::e_load_imm,
+                  .dest = instr.dest,
+                  .immediate = std::to_string(value),
+                  .comment = std::move(instr.comment)};
+      }
+
+      class block_folder
+      {
+      public:
+         /**
+          * @brief Fold the instructions of the block, registers are only read in the block
+          * writing them so nothing is carried over from other blocks
+          */
+         auto fold(basic_block& block) -> std::size_t
+         {
+            std::size_t rewrites = 0;
+            for (auto it = std::begin(block.instructions); it != std::end(block.instructions);)
+            {
+               const auto result = fold(*it);
+               if (result == outcome::e_removed)
+               {
+                  it = block.instructions.erase(it);
+               }
+               else
+               {
+                  ++it;
+               }
+
+               if (result != outcome::e_unchanged)
+               {
+                  ++rewrites;
+               }
+            }
+
+            return rewrites;
+         }
+
+      private:
+         enum struct outcome
+         {
+            e_unchanged,
+            e_rewritten,
+            e_removed
+         };
+
+         auto fold(instruction& instr) -> outcome
+         {
+            switch (instr.op)
+            {
+               case opcode::e_load_imm:
+                  if (const auto value = parse_immediate(instr.immediate))
+                  {
+                     remember(instr.dest, *value);
+                  }
+                  return outcome::e_unchanged;
+               case opcode::e_load:
+                  if (const auto it = m_memory.find(instr.label); it != std::end(m_memory))
+                  {
+                     const auto value = it->second;
+                     load_constant(instr, value);
+                     remember(instr.dest, value);
+                     return outcome::e_rewritten;
+                  }
+                  return outcome::e_unchanged;
+               case opcode::e_store:
+                  if (const auto value = known(instr.lhs))
+                  {
+                     m_memory.try_emplace(instr.label).first->second = *value;
+                  }
+                  else
+                  {
+                     m_memory.erase(instr.label);
+                  }
+                  return outcome::e_unchanged;
+               case opcode::e_copy:
+                  if (const auto value = known(instr.lhs))
+                  {
+                     load_constant(instr, *value);
+                     remember(instr.dest, *value);
+                     return outcome::e_rewritten;
+                  }
+                  return outcome::e_unchanged;
+               case opcode::e_branch_zero:
+                  if (const auto value = known(instr.lhs))
+                  {
+                     if (*value != 0)
+                     {
+                        return outcome::e_removed;
+                     }
+
+                     instr = {.op = opcode::e_jump,
+                              .label = std::move(instr.label),
+                              .comment = std::move(instr.comment)};
+                     return outcome::e_rewritten;
+                  }
+                  return outcome::e_unchanged;
+               default:
+                  return is_arithmetic(instr.op) ? fold_arithmetic(instr) : outcome::e_unchanged;
+            }
+         }
+
+         auto fold_arithmetic(instruction& instr) -> outcome
+         {
+            const auto lhs = known(instr.lhs);
+            const auto rhs =
+               reads_rhs(instr) ? known(instr.rhs) : parse_immediate(instr.immediate);
+
+            if (lhs && rhs)
+            {
+               const auto value = evaluate(instr.op, *lhs, *rhs);
+               if (value && fits_immediate(*value))
+               {
+                  load_constant(instr, *value);
+                  remember(instr.dest, *value);
+                  return outcome::e_rewritten;
+               }
+            }
+
+            if (reads_rhs(instr) && rhs)
+            {
+               instr.immediate = std::to_string(*rhs);
+               return outcome::e_rewritten;
+            }
+
+            if (reads_rhs(instr) && lhs)
+            {
+               if (const auto op = swapped(instr.op))
+               {
+                  instr.op = *op;
+                  instr.lhs = instr.rhs;
+                  instr.immediate = std::to_string(*lhs);
+                  return outcome::e_rewritten;
+               }
+            }
+
+            return outcome::e_unchanged;
+         }
+
+         [[nodiscard]] auto known(virtual_register reg) const -> std::optional<std::int32_t>
+         {
+            if (const auto it = m_registers.find(reg); it != std::end(m_registers))
+            {
+               return it->second;
+            }
+
+            return std::nullopt;
+         }
+         void remember(virtual_register reg, std::int32_t value)
+         {
+            m_registers.try_emplace(reg, value);
+         }
+
+      private:
+         util::flat_hash_map<virtual_register, std::int32_t> m_registers;
+         util::flat_hash_map<std::string, std::int32_t> m_memory;
+      };
+   } // namespace
+
+   auto fold_constants(program& prog) -> std::size_t
+   {
+      std::size_t rewrites = 0;
+      for (auto& func : prog.functions)
+      {
+         for (auto& block : func.blocks)
+         {
+            rewrites += block_folder{}.fold(block);
+         }
+      }
+
+      return rewrites;
+   }
+} // namespace munster::ir
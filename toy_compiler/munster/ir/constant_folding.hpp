@@ -0,0 +1,43 @@
+/**
+ * @file constant_folding.hpp
+ * @brief Contains the pass computing the instructions of a program whose operands are known at
+ * compile time
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <toy_compiler/munster/ir/program.hpp>
+
+#include <cstddef>
+
+namespace munster::ir
+{
+   /**
+    * @brief Fold the constants of every basic block of the program. Arithmetic over known
+    * integers becomes a single `e_load_imm`, a known operand becomes an immediate, a load of
+    * memory the block stored a known integer to becomes that integer, and a branch on a known
+    * condition becomes a jump or goes away.
+    *
+    * Values are computed on 32 bit words like Moon does. A value that doesn't fit in the 16 bit
+    * immediates of Moon, or a division by 0, is left to be computed when the program runs.
+    * Literals that aren't integers are never folded. The instructions computing the operands of
+    * a folded instruction are left in place even if nothing reads them anymore
+    *
+    * @return The number of instructions rewritten or removed
+    */
+   auto fold_constants(program& prog) -> std::size_t;
+} // namespace munster::ir
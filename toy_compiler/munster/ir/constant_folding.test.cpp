@@ -0,0 +1,138 @@
+/**
+ * @brief Runs tests on functions defined in constant_folding.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ir/constant_folding.hpp>
+
+using namespace munster::ir;
+
+namespace
+{
+   auto reg(std::uint32_t i) -> virtual_register { return virtual_register{i}; }
+
+   auto make_program(std::vector<instruction> code) -> program
+   {
+      return {.functions = {{.label = "main",
+                             .kind = function_kind::e_main,
+                             .blocks = {{.instructions = std::move(code)}}}}};
+   }
+
+   auto code_of(const program& prog) -> const std::vector<instruction>&
+   {
+      return prog.functions.front().blocks.front().instructions;
+   }
+} // namespace
+
+TEST_SUITE("constant_folding test suite")
+{
+   TEST_CASE("arithmetic over literals")
+   {
+      // x = 1 + 2 * 3
+      auto prog = make_program(
+         {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "2"},
+          {.op = opcode::e_mul, .dest = reg(1), .lhs = reg(0), .immediate = "3"},
+          {.op = opcode::e_load_imm, .dest = reg(2), .immediate = "1"},
+          {.op = opcode::e_add, .dest = reg(3), .lhs = reg(2), .rhs = reg(1)},
+          {.op = opcode::e_store, .lhs = reg(3), .label = "main_x"}});
+
+      CHECK(fold_constants(prog) == 2);
+
+      const auto& code = code_of(prog);
+      REQUIRE(std::size(code) == 5);
+      CHECK(code[1].op == opcode::e_load_imm);
+      CHECK(code[1].immediate == "6");
+      CHECK(code[3].op == opcode::e_load_imm);
+      CHECK(code[3].dest == reg(3));
+      CHECK(code[3].immediate == "7");
+      CHECK(code[4].op == opcode::e_store);
+   }
+   TEST_CASE("values stored to memory are propagated to later loads")
+   {
+      // x = 5; y = x + 1; x = z; y = x
+      auto prog = make_program(
+         {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "5"},
+          {.op = opcode::e_store, .lhs = reg(0), .label = "main_x"},
+          {.op = opcode::e_load, .dest = reg(1), .label = "main_x"},
+          {.op = opcode::e_add, .dest = reg(2), .lhs = reg(1), .immediate = "1"},
+          {.op = opcode::e_store, .lhs = reg(2), .label = "main_y"},
+          {.op = opcode::e_load, .dest = reg(3), .label = "main_z"},
+          {.op = opcode::e_store, .lhs = reg(3), .label = "main_x"},
+          {.op = opcode::e_load, .dest = reg(4), .label = "main_x"},
+          {.op = opcode::e_store, .lhs = reg(4), .label = "main_y"}});
+
+      CHECK(fold_constants(prog) == 2);
+
+      const auto& code = code_of(prog);
+      CHECK(code[2].op == opcode::e_load_imm);
+      CHECK(code[2].immediate == "5");
+      CHECK(code[3].op == opcode::e_load_imm);
+      CHECK(code[3].immediate == "6");
+      CHECK(code[7].op == opcode::e_load);
+   }
+   TEST_CASE("branches on known conditions")
+   {
+      auto prog = make_program(
+         {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "1"},
+          {.op = opcode::e_lt, .dest = reg(1), .lhs = reg(0), .immediate = "2"},
+          {.op = opcode::e_branch_zero, .lhs = reg(1), .label = "else_0"}});
+
+      CHECK(fold_constants(prog) == 2);
+      REQUIRE(std::size(code_of(prog)) == 2);
+      CHECK(code_of(prog).back().immediate == "1");
+
+      prog = make_program(
+         {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "0"},
+          {.op = opcode::e_branch_zero, .lhs = reg(0), .label = "wh_end_0"}});
+
+      CHECK(fold_constants(prog) == 1);
+      CHECK(code_of(prog).back().op == opcode::e_jump);
+      CHECK(code_of(prog).back().label == "wh_end_0");
+   }
+   TEST_CASE("known operands become immediates")
+   {
+      // 2 < x is x > 2
+      auto prog = make_program(
+         {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "2"},
+          {.op = opcode::e_load, .dest = reg(1), .label = "main_x"},
+          {.op = opcode::e_lt, .dest = reg(2), .lhs = reg(0), .rhs = reg(1)},
+          {.op = opcode::e_sub, .dest = reg(3), .lhs = reg(1), .rhs = reg(0)}});
+
+      CHECK(fold_constants(prog) == 2);
+
+      const auto& code = code_of(prog);
+      CHECK(code[2].op == opcode::e_gt);
+      CHECK(code[2].lhs == reg(1));
+      CHECK(code[2].immediate == "2");
+      CHECK(code[3].op == opcode::e_sub);
+      CHECK(code[3].immediate == "2");
+   }
+   TEST_CASE("values left to the running program")
+   {
+      auto prog = make_program(
+         {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "1"},
+          {.op = opcode::e_div, .dest = reg(1), .lhs = reg(0), .immediate = "0"},
+          {.op = opcode::e_load_imm, .dest = reg(2), .immediate = "200"},
+          {.op = opcode::e_mul, .dest = reg(3), .lhs = reg(2), .immediate = "200"},
+          {.op = opcode::e_load_imm, .dest = reg(4), .immediate = "1.5"},
+          {.op = opcode::e_add, .dest = reg(5), .lhs = reg(4), .immediate = "1"}});
+
+      CHECK(fold_constants(prog) == 0);
+   }
+}
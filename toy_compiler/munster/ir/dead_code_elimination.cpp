@@ -0,0 +1,354 @@
+/**
+ * @file dead_code_elimination.cpp
+ * @brief Implement the functions defined at dead_code_elimination.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/ir/dead_code_elimination.hpp>
+
+#include <toy_compiler/util/flat_hash_map.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace munster::ir
+{
+   namespace
+   {
+      auto uses_memory(opcode op) -> bool
+      {
+         return op == opcode::e_load || op == opcode::e_store || op == opcode::e_return;
+      }
+
+      /**
+       * @brief The liveness of the memory of a function, one bit per label it loads or stores
+       */
+      class memory_liveness
+      {
+      public:
+         explicit memory_liveness(const function& func) : m_func{func}
+         {
+            for (std::size_t i = 0; i < std::size(func.blocks); ++i)
+            {
+               if (!std::empty(func.blocks[i].label))
+               {
+                  m_block_of.try_emplace(func.blocks[i].label, i);
+               }
+
+               for (const auto& instr : func.blocks[i].instructions)
+               {
+                  if (instr.op == opcode::e_load || instr.op == opcode::e_store)
+                  {
+                     m_label_ids.try_emplace(instr.label, std::size(m_label_ids));
+                  }
+               }
+            }
+
+            solve();
+         }
+
+         [[nodiscard]] auto label_id(const std::string& label) const -> std::size_t
+         {
+            return m_label_ids.find(label)->second;
+         }
+         [[nodiscard]] auto live_out(std::size_t block) const -> const std::vector<bool>&
+         {
+            return m_live_out[block];
+         }
+
+      private:
+         /**
+          * @brief The blocks the block may go to next, nothing if it leaves the function
+          */
+         [[nodiscard]] auto successors(std::size_t block) const -> std::vector<std::size_t>
+         {
+            const auto fallthrough = [&]() -> std::vector<std::size_t> {
+               if (block + 1 < std::size(m_func.blocks))
+               {
+                  return {block + 1};
+               }
+
+               return {};
+            };
+            const auto target = [&](const std::string& label) -> std::vector<std::size_t> {
+               if (const auto it = m_block_of.find(label); it != std::end(m_block_of))
+               {
+                  return {it->second};
+               }
+
+               return {};
+            };
+
+            const auto& instructions = m_func.blocks[block].instructions;
+            if (std::empty(instructions))
+            {
+               return fallthrough();
+            }
+
+            const auto& last = instructions.back();
+            switch (last.op)
+            {
+               case opcode::e_jump:
+                  return target(last.label);
+               case opcode::e_branch_zero: {
+                  auto next = fallthrough();
+                  const auto taken = target(last.label);
+                  next.insert(std::end(next), std::begin(taken), std::end(taken));
+                  return next;
+               }
+               case opcode::e_return:
+               case opcode::e_halt:
+                  return {};
+               default:
+                  return fallthrough();
+            }
+         }
+         /**
+          * @brief Whether the function may be left once the block is done
+          */
+         [[nodiscard]] auto exits(std::size_t block) const -> bool
+         {
+            const bool is_last = block + 1 == std::size(m_func.blocks);
+
+            const auto& instructions = m_func.blocks[block].instructions;
+            if (std::empty(instructions))
+            {
+               return is_last;
+            }
+
+            const auto& last = instructions.back();
+            switch (last.op)
+            {
+               case opcode::e_jump:
+                  return !m_block_of.contains(last.label);
+               case opcode::e_branch_zero:
+                  return is_last || !m_block_of.contains(last.label);
+               case opcode::e_return:
+               case opcode::e_halt:
+                  return true;
+               default:
+                  return is_last;
+            }
+         }
+
+         /**
+          * @brief Solve the backward dataflow of the memory read before being stored to, until
+          * nothing changes
+          */
+         void solve()
+         {
+            const auto block_count = std::size(m_func.blocks);
+            const auto label_count = std::size(m_label_ids);
+
+            std::vector<std::vector<bool>> uses(block_count, std::vector<bool>(label_count));
+            std::vector<std::vector<bool>> kills(block_count, std::vector<bool>(label_count));
+            for (std::size_t b = 0; b < block_count; ++b)
+            {
+               for (const auto& instr : m_func.blocks[b].instructions)
+               {
+                  if (instr.op == opcode::e_load && !kills[b][label_id(instr.label)])
+                  {
+                     uses[b][label_id(instr.label)] = true;
+                  }
+                  else if (instr.op == opcode::e_store)
+                  {
+                     kills[b][label_id(instr.label)] = true;
+                  }
+               }
+            }
+
+            std::vector<std::vector<bool>> live_in(block_count, std::vector<bool>(label_count));
+            m_live_out.assign(block_count, std::vector<bool>(label_count));
+
+            for (bool changed = true; changed;)
+            {
+               changed = false;
+               for (std::size_t b = block_count; b-- > 0;)
+               {
+                  auto out = std::vector<bool>(label_count, exits(b));
+                  for (const auto next : successors(b))
+                  {
+                     for (std::size_t l = 0; l < label_count; ++l)
+                     {
+                        out[l] = out[l] || live_in[next][l];
+                     }
+                  }
+
+                  auto in = uses[b];
+                  for (std::size_t l = 0; l < label_count; ++l)
+                  {
+                     in[l] = in[l] || (out[l] && !kills[b][l]);
+                  }
+
+                  if (in != live_in[b] || out != m_live_out[b])
+                  {
+                     live_in[b] = std::move(in);
+                     m_live_out[b] = std::move(out);
+                     changed = true;
+                  }
+               }
+            }
+         }
+
+      private:
+         const function& m_func;
+
+         util::flat_hash_map<std::string, std::size_t> m_block_of;
+         util::flat_hash_map<std::string, std::size_t> m_label_ids;
+         std::vector<std::vector<bool>> m_live_out;
+      };
+
+      /**
+       * @brief The registers the block writes or reads, as the first one & one past the last one.
+       * Registers are numbered across the whole program, but the ones of a block are close
+       */
+      auto register_range(const basic_block& block) -> std::pair<std::size_t, std::size_t>
+      {
+         auto first = std::numeric_limits<std::size_t>::max();
+         std::size_t last = 0;
+
+         const auto include = [&](virtual_register reg) {
+            const auto i = static_cast<std::size_t>(reg);
+            first = std::min(first, i);
+            last = std::max(last, i + 1);
+         };
+
+         for (const auto& instr : block.instructions)
+         {
+            if (writes_dest(instr))
+            {
+               include(instr.dest);
+            }
+            if (reads_lhs(instr))
+            {
+               include(instr.lhs);
+            }
+            if (reads_rhs(instr))
+            {
+               include(instr.rhs);
+            }
+         }
+
+         return first < last ? std::pair{first, last} : std::pair{std::size_t{0}, std::size_t{0}};
+      }
+
+      /**
+       * @brief Walk the block backward, keeping the registers and memory read by the
+       * instructions after the current one. Registers are only read in the block writing them,
+       * so none is live when the block ends
+       */
+      void sweep(basic_block& block, const memory_liveness& liveness, std::size_t block_index,
+                 elimination_stats& stats)
+      {
+         auto live_memory = liveness.live_out(block_index);
+
+         // one bit per register of the block, whatever the number of registers of the program
+         const auto registers = register_range(block);
+         const auto first_register = registers.first;
+         std::vector<bool> live_registers(registers.second - registers.first);
+
+         const auto is_live = [&](virtual_register reg) {
+            return live_registers[static_cast<std::size_t>(reg) - first_register];
+         };
+         const auto set_live = [&](virtual_register reg, bool live) {
+            live_registers[static_cast<std::size_t>(reg) - first_register] = live;
+         };
+
+         std::vector<instruction> kept;
+         kept.reserve(std::size(block.instructions));
+         for (auto it = std::rbegin(block.instructions); it != std::rend(block.instructions); ++it)
+         {
+            auto& instr = *it;
+            if (instr.op == opcode::e_store)
+            {
+               const auto label = liveness.label_id(instr.label);
+               if (!live_memory[label])
+               {
+                  ++stats.dead_stores;
+                  continue;
+               }
+
+               live_memory[label] = false;
+            }
+            else if (writes_dest(instr))
+            {
+               if (!is_live(instr.dest))
+               {
+                  ++stats.dead_values;
+                  continue;
+               }
+
+               set_live(instr.dest, false);
+               if (instr.op == opcode::e_load)
+               {
+                  live_memory[liveness.label_id(instr.label)] = true;
+               }
+            }
+
+            if (reads_lhs(instr))
+            {
+               set_live(instr.lhs, true);
+            }
+            if (reads_rhs(instr))
+            {
+               set_live(instr.rhs, true);
+            }
+
+            kept.push_back(std::move(instr));
+         }
+
+         std::reverse(std::begin(kept), std::end(kept));
+         block.instructions = std::move(kept);
+      }
+   } // namespace
+
+   auto eliminate_dead_code(program& prog) -> elimination_stats
+   {
+      elimination_stats stats;
+
+      util::flat_hash_map<std::string, bool> used_labels;
+      for (auto& func : prog.functions)
+      {
+         const memory_liveness liveness{func};
+         for (std::size_t b = 0; b < std::size(func.blocks); ++b)
+         {
+            sweep(func.blocks[b], liveness, b, stats);
+         }
+
+         for (const auto& block : func.blocks)
+         {
+            for (const auto& instr : block.instructions)
+            {
+               if (uses_memory(instr.op))
+               {
+                  used_labels.try_emplace(instr.label, true);
+               }
+            }
+         }
+      }
+
+      const auto unused = std::ranges::remove_if(prog.data, [&](const reservation& data) {
+         return !used_labels.contains(data.label);
+      });
+      stats.dead_reservations = std::size(unused);
+      prog.data.erase(std::begin(unused), std::end(unused));
+
+      return stats;
+   }
+} // namespace munster::ir
@@ -0,0 +1,47 @@
+/**
+ * @file dead_code_elimination.hpp
+ * @brief Contains the pass removing the instructions and the memory of a program whose values are
+ * never read
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <toy_compiler/munster/ir/program.hpp>
+
+#include <cstddef>
+
+namespace munster::ir
+{
+   struct elimination_stats
+   {
+      std::size_t dead_values{};       // NOLINT
+      std::size_t dead_stores{};       // NOLINT
+      std::size_t dead_reservations{}; // NOLINT
+   };
+
+   /**
+    * @brief Remove what the program computes but never reads, using the liveness of the
+    * registers and of the memory of each function:
+    *
+    * - an instruction writing a register no instruction reads afterwards,
+    * - a store to memory that is always stored to again before being loaded,
+    * - the reservation of memory no instruction uses.
+    *
+    * Memory may be read once a function returns, so all of it is live when a function exits
+    */
+   auto eliminate_dead_code(program& prog) -> elimination_stats;
+} // namespace munster::ir
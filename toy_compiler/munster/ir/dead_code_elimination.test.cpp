@@ -0,0 +1,165 @@
+/**
+ * @brief Runs tests on functions defined in dead_code_elimination.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ir/dead_code_elimination.hpp>
+
+using namespace munster::ir;
+
+namespace
+{
+   auto reg(std::uint32_t i) -> virtual_register { return virtual_register{i}; }
+
+   auto make_program(std::vector<basic_block> blocks) -> program
+   {
+      return {.functions = {
+                 {.label = "main", .kind = function_kind::e_main, .blocks = std::move(blocks)}}};
+   }
+} // namespace
+
+TEST_SUITE("dead_code_elimination test suite")
+{
+   TEST_CASE("values nothing reads")
+   {
+      auto prog = make_program(
+         {{.instructions = {
+              {.op = opcode::e_load, .dest = reg(0), .label = "main_x"},
+              {.op = opcode::e_add, .dest = reg(1), .lhs = reg(0), .immediate = "1"},
+              {.op = opcode::e_load_imm, .dest = reg(2), .immediate = "2"},
+              {.op = opcode::e_store, .lhs = reg(2), .label = "main_y"},
+              {.op = opcode::e_halt}}}});
+
+      const auto stats = eliminate_dead_code(prog);
+
+      CHECK(stats.dead_values == 2);
+      CHECK(stats.dead_stores == 0);
+
+      const auto& code = prog.functions.front().blocks.front().instructions;
+      REQUIRE(std::size(code) == 3);
+      CHECK(code[0].op == opcode::e_load_imm);
+      CHECK(code[1].op == opcode::e_store);
+      CHECK(code[2].op == opcode::e_halt);
+   }
+   TEST_CASE("stores overwritten before being loaded")
+   {
+      // x = 1; x = 2; y = x
+      auto prog = make_program(
+         {{.instructions = {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "1"},
+                            {.op = opcode::e_store, .lhs = reg(0), .label = "main_x"},
+                            {.op = opcode::e_load_imm, .dest = reg(1), .immediate = "2"},
+                            {.op = opcode::e_store, .lhs = reg(1), .label = "main_x"},
+                            {.op = opcode::e_load, .dest = reg(2), .label = "main_x"},
+                            {.op = opcode::e_store, .lhs = reg(2), .label = "main_y"},
+                            {.op = opcode::e_halt}}}});
+
+      const auto stats = eliminate_dead_code(prog);
+
+      CHECK(stats.dead_stores == 1);
+      CHECK(stats.dead_values == 1);
+      CHECK(std::size(prog.functions.front().blocks.front().instructions) == 5);
+   }
+   TEST_CASE("stores overwritten on every path")
+   {
+      // x = 1; if (c) then x = 2; else x = 3;
+      auto prog = make_program(
+         {{.instructions = {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "1"},
+                            {.op = opcode::e_store, .lhs = reg(0), .label = "main_x"},
+                            {.op = opcode::e_load, .dest = reg(1), .label = "main_c"},
+                            {.op = opcode::e_branch_zero, .lhs = reg(1), .label = "else_0"}}},
+          {.instructions = {{.op = opcode::e_load_imm, .dest = reg(2), .immediate = "2"},
+                            {.op = opcode::e_store, .lhs = reg(2), .label = "main_x"},
+                            {.op = opcode::e_jump, .label = "if_end_0"}}},
+          {.label = "else_0",
+           .instructions = {{.op = opcode::e_load_imm, .dest = reg(3), .immediate = "3"},
+                            {.op = opcode::e_store, .lhs = reg(3), .label = "main_x"}}},
+          {.label = "if_end_0", .instructions = {{.op = opcode::e_halt}}}});
+
+      const auto stats = eliminate_dead_code(prog);
+
+      CHECK(stats.dead_stores == 1);
+      CHECK(stats.dead_values == 1);
+      CHECK(std::size(prog.functions.front().blocks.front().instructions) == 2);
+   }
+   TEST_CASE("stores loaded by a loop are kept")
+   {
+      // x = 1; while (x < 10) x = x + 1;
+      auto prog = make_program(
+         {{.instructions = {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "1"},
+                            {.op = opcode::e_store, .lhs = reg(0), .label = "main_x"}}},
+          {.label = "wh_beg_0",
+           .instructions = {{.op = opcode::e_load, .dest = reg(1), .label = "main_x"},
+                            {.op = opcode::e_lt, .dest = reg(2), .lhs = reg(1), .immediate = "10"},
+                            {.op = opcode::e_branch_zero, .lhs = reg(2), .label = "wh_end_0"}}},
+          {.instructions = {{.op = opcode::e_load, .dest = reg(3), .label = "main_x"},
+                            {.op = opcode::e_add, .dest = reg(4), .lhs = reg(3), .immediate = "1"},
+                            {.op = opcode::e_store, .lhs = reg(4), .label = "main_x"},
+                            {.op = opcode::e_jump, .label = "wh_beg_0"}}},
+          {.label = "wh_end_0", .instructions = {{.op = opcode::e_halt}}}});
+
+      const auto stats = eliminate_dead_code(prog);
+
+      CHECK(stats.dead_stores == 0);
+      CHECK(stats.dead_values == 0);
+   }
+   TEST_CASE("memory nothing uses")
+   {
+      auto prog = make_program(
+         {{.instructions = {{.op = opcode::e_load_imm, .dest = reg(0), .immediate = "1"},
+                            {.op = opcode::e_store, .lhs = reg(0), .label = "main_x"},
+                            {.op = opcode::e_return, .label = "main_callsite0"}}}});
+      prog.data = {{.label = "main_x", .size = 4},
+                   {.label = "main_y", .size = 8},
+                   {.label = "main_callsite0", .size = 4}};
+
+      const auto stats = eliminate_dead_code(prog);
+
+      CHECK(stats.dead_reservations == 1);
+      REQUIRE(std::size(prog.data) == 2);
+      CHECK(prog.data[0].label == "main_x");
+      CHECK(prog.data[1].label == "main_callsite0");
+   }
+   TEST_CASE("registers numbered after the ones of earlier functions")
+   {
+      // registers aren't numbered from 0 in every function
+      auto prog = make_program(
+         {{.instructions = {
+              {.op = opcode::e_load, .dest = reg(4'000'000), .label = "main_x"},
+              {.op = opcode::e_mul,
+               .dest = reg(4'000'001),
+               .lhs = reg(4'000'000),
+               .immediate = "2"},
+              {.op = opcode::e_load_imm, .dest = reg(4'000'002), .immediate = "3"},
+              {.op = opcode::e_store, .lhs = reg(4'000'001), .label = "main_y"},
+              {.op = opcode::e_halt}}},
+          {.instructions = {{.op = opcode::e_load_imm, .dest = reg(12), .immediate = "1"},
+                            {.op = opcode::e_store, .lhs = reg(12), .label = "main_x"},
+                            {.op = opcode::e_halt}}}});
+
+      const auto stats = eliminate_dead_code(prog);
+
+      CHECK(stats.dead_values == 1);
+
+      const auto& code = prog.functions.front().blocks.front().instructions;
+      REQUIRE(std::size(code) == 4);
+      CHECK(code[0].op == opcode::e_load);
+      CHECK(code[1].op == opcode::e_mul);
+      CHECK(code[2].op == opcode::e_store);
+   }
+}
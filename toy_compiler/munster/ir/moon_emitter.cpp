@@ -0,0 +1,348 @@
+/**
+ * @file moon_emitter.cpp
+ * @brief Implement the functions defined at moon_emitter.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/ir/moon_emitter.hpp>
+
+#include <toy_compiler/munster/ir/register_allocator.hpp>
+#include <toy_compiler/util/flat_hash_map.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace munster::ir
+{
+   namespace
+   {
+      constexpr std::string_view spacing{"          "};
+
+      // r12 and r13 are kept to load spilled operands and hold spilled results
+      constexpr std::array registers{
+         register_type::e_r1, register_type::e_r2, register_type::e_r3,  register_type::e_r4,
+         register_type::e_r5, register_type::e_r6, register_type::e_r7,  register_type::e_r8,
+         register_type::e_r9, register_type::e_r10, register_type::e_r11};
+      constexpr auto lhs_scratch = register_type::e_r12;
+      constexpr auto rhs_scratch = register_type::e_r13;
+
+      auto to_string(register_type reg) -> std::string { return fmt::format("{}", reg); }
+      auto memory(std::string_view label) -> std::string { return fmt::format("{}(r0)", label); }
+
+      auto mnemonic(opcode op) -> std::string_view
+      {
+         switch (op)
+         {
+            case opcode::e_add:
+               return "add";
+            case opcode::e_sub:
+               return "sub";
+            case opcode::e_or:
+               return "or";
+            case opcode::e_mul:
+               return "mul";
+            case opcode::e_div:
+               return "div";
+            case opcode::e_and:
+               return "and";
+            case opcode::e_eq:
+               return "ceq";
+            case opcode::e_ne:
+               return "cne";
+            case opcode::e_lt:
+               return "clt";
+            case opcode::e_gt:
+               return "cgt";
+            case opcode::e_le:
+               return "cle";
+            default:
+               return "cge";
+         }
+      }
+
+      /**
+       * @brief Writes the blocks of a single function, the label of a block is written in front
+       * of its first line
+       */
+      class function_emitter
+      {
+      public:
+         function_emitter(const function& func, std::vector<moon_line>& output,
+                          std::vector<reservation>& spills) :
+            m_func{func},
+            m_output{output}
+         {
+            allocate(spills);
+         }
+
+         void emit()
+         {
+            if (m_func.kind == function_kind::e_main)
+            {
+               line("entry", {});
+               line("addi", {"r14", "r0", "topaddr"});
+               m_output.emplace_back();
+            }
+            else
+            {
+               m_label = m_func.label;
+            }
+
+            for (const auto& block : m_func.blocks)
+            {
+               if (!std::empty(block.label))
+               {
+                  flush_label();
+                  m_label = block.label;
+               }
+
+               for (const auto& instr : block.instructions)
+               {
+                  emit(instr);
+               }
+            }
+
+            flush_label();
+            m_output.emplace_back();
+         }
+
+      private:
+         /**
+          * @brief Values are written once and live in a single block, so a value lives from the
+          * instruction writing it to the last one reading it in the order the blocks are laid
+          * out
+          */
+         void allocate(std::vector<reservation>& spills)
+         {
+            std::uint32_t at = 0;
+            const auto touch = [&](virtual_register value) {
+               const auto [it, inserted] = m_interval_of.try_emplace(value, std::size(m_intervals));
+               if (inserted)
+               {
+                  m_intervals.push_back({.start = at, .end = at});
+               }
+               else
+               {
+                  m_intervals[it->second].end = at;
+               }
+            };
+
+            for (const auto& block : m_func.blocks)
+            {
+               for (const auto& instr : block.instructions)
+               {
+                  if (reads_lhs(instr))
+                  {
+                     touch(instr.lhs);
+                  }
+                  if (reads_rhs(instr))
+                  {
+                     touch(instr.rhs);
+                  }
+                  if (writes_dest(instr))
+                  {
+                     touch(instr.dest);
+                  }
+
+                  ++at;
+               }
+            }
+
+            m_assigned = linear_scan(m_intervals, registers);
+
+            m_spill_labels.resize(std::size(m_intervals));
+            for (std::size_t i = 0; i < std::size(m_intervals); ++i)
+            {
+               if (!m_assigned[i])
+               {
+                  m_spill_labels[i] = fmt::format("{}_temp{}", m_func.label, std::size(spills));
+                  spills.push_back({.label = m_spill_labels[i], .size = 4});
+               }
+            }
+         }
+
+         void line(std::string mnemonic, std::vector<std::string> operands,
+                   std::string comment = {})
+         {
+            m_output.push_back({.label = std::exchange(m_label, {}),
+                                .mnemonic = std::move(mnemonic),
+                                .operands = std::move(operands),
+                                .comment = std::move(comment)});
+         }
+         void flush_label()
+         {
+            if (!std::empty(m_label))
+            {
+               m_output.push_back({.label = std::exchange(m_label, {})});
+            }
+         }
+
+         auto read(virtual_register value, register_type scratch) -> register_type
+         {
+            const auto i = m_interval_of.find(value)->second;
+            if (m_assigned[i])
+            {
+               return m_assigned[i].value();
+            }
+
+            line("lw", {to_string(scratch), memory(m_spill_labels[i])});
+            return scratch;
+         }
+
+         void emit(const instruction& instr)
+         {
+            const auto lhs = reads_lhs(instr) ? read(instr.lhs, lhs_scratch) : register_type::e_r0;
+            const auto rhs = reads_rhs(instr) ? read(instr.rhs, rhs_scratch) : register_type::e_r0;
+
+            std::size_t dest_interval = 0;
+            auto dest = register_type::e_r0;
+            if (writes_dest(instr))
+            {
+               dest_interval = m_interval_of.find(instr.dest)->second;
+               dest = m_assigned[dest_interval].value_or(lhs_scratch);
+            }
+
+            switch (instr.op)
+            {
+               case opcode::e_load:
+                  line("lw", {to_string(dest), memory(instr.label)}, instr.comment);
+                  break;
+               case opcode::e_store:
+                  line("sw", {memory(instr.label), to_string(lhs)}, instr.comment);
+                  break;
+               case opcode::e_load_imm:
+                  line("addi", {to_string(dest), "r0", instr.immediate}, instr.comment);
+                  break;
+               case opcode::e_copy:
+                  line("add", {to_string(dest), to_string(lhs), "r0"}, instr.comment);
+                  break;
+               case opcode::e_jump:
+                  line("j", {instr.label}, instr.comment);
+                  break;
+               case opcode::e_branch_zero:
+                  line("bz", {to_string(lhs), instr.label}, instr.comment);
+                  break;
+               case opcode::e_return:
+                  line("lw", {"r15", memory(instr.label)}, instr.comment);
+                  line("jr", {"r15"});
+                  break;
+               case opcode::e_halt:
+                  line("hlt", {}, instr.comment);
+                  break;
+               default:
+                  if (std::empty(instr.immediate))
+                  {
+                     line(std::string{mnemonic(instr.op)},
+                          {to_string(dest), to_string(lhs), to_string(rhs)}, instr.comment);
+                  }
+                  else
+                  {
+                     line(fmt::format("{}i", mnemonic(instr.op)),
+                          {to_string(dest), to_string(lhs), instr.immediate}, instr.comment);
+                  }
+                  break;
+            }
+
+            if (writes_dest(instr) && !m_assigned[dest_interval])
+            {
+               line("sw", {memory(m_spill_labels[dest_interval]), to_string(dest)});
+            }
+         }
+
+      private:
+         const function& m_func;
+         std::vector<moon_line>& m_output;
+
+         std::string m_label;
+
+         util::flat_hash_map<virtual_register, std::size_t> m_interval_of;
+         std::vector<live_interval> m_intervals;
+         std::vector<std::optional<register_type>> m_assigned;
+         std::vector<std::string> m_spill_labels;
+      };
+   } // namespace
+
+   auto emit_moon_lines(const program& prog) -> std::vector<moon_line>
+   {
+      std::vector<moon_line> output;
+      std::vector<reservation> spills;
+
+      for (const auto& func : prog.functions)
+      {
+         function_emitter{func, output, spills}.emit();
+      }
+
+      const auto reserve = [&](std::span<const reservation> data) {
+         for (const auto& [label, size] : data)
+         {
+            output.push_back(
+               {.label = label, .mnemonic = "res", .operands = {std::to_string(size)}});
+         }
+      };
+
+      reserve(prog.data);
+      reserve(spills);
+
+      return output;
+   }
+
+   auto format_moon(std::span<const moon_line> lines) -> std::string
+   {
+      std::string output;
+      for (const auto& line : lines)
+      {
+         if (line.mnemonic == "res")
+         {
+            output += fmt::format("{:<30} {} {}\n", line.label, line.mnemonic,
+                                  line.operands.front());
+            continue;
+         }
+
+         if (std::empty(line.mnemonic))
+         {
+            output += fmt::format("{}\n", line.label);
+            continue;
+         }
+
+         auto body = line.mnemonic;
+         if (!std::empty(line.operands))
+         {
+            body += fmt::format(" {}", fmt::join(line.operands, ", "));
+         }
+         if (!std::empty(line.comment))
+         {
+            body += fmt::format(" {}", line.comment);
+         }
+
+         if (std::empty(line.label))
+         {
+            output += fmt::format("{}{}\n", spacing, body);
+         }
+         else
+         {
+            output += fmt::format("{:<9} {}\n", line.label, body);
+         }
+      }
+
+      return output;
+   }
+
+   auto emit_moon(const program& prog) -> std::string { return format_moon(emit_moon_lines(prog)); }
+} // namespace munster::ir
@@ -0,0 +1,57 @@
+/**
+ * @file moon_emitter.hpp
+ * @brief Contains the function writing a program of the intermediate representation as Moon code
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <toy_compiler/munster/ir/program.hpp>
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace munster::ir
+{
+   /**
+    * @brief A line of Moon code: an instruction or a `res` directive with the label in front of
+    * it, a label alone if there is no mnemonic, or a blank line if there is nothing
+    */
+   struct moon_line
+   {
+      std::string label{};                 // NOLINT
+      std::string mnemonic{};              // NOLINT
+      std::vector<std::string> operands{}; // NOLINT
+      std::string comment{};               // NOLINT
+   };
+
+   /**
+    * @brief Write the program as lines of Moon code. The virtual registers of each function are
+    * given machine registers with a linear scan, those that don't fit are spilled to memory
+    * reserved at the end of the program along with the data of the program
+    */
+   auto emit_moon_lines(const program& prog) -> std::vector<moon_line>;
+   /**
+    * @brief Lay out the lines as the text of a Moon source file
+    */
+   auto format_moon(std::span<const moon_line> lines) -> std::string;
+
+   /**
+    * @brief Write the program as the text of a Moon source file, see `emit_moon_lines`
+    */
+   auto emit_moon(const program& prog) -> std::string;
+} // namespace munster::ir
@@ -0,0 +1,109 @@
+/**
+ * @brief Runs tests on functions defined in moon_emitter.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ir/moon_emitter.hpp>
+
+using namespace munster::ir;
+
+TEST_SUITE("moon_emitter test suite")
+{
+   TEST_CASE("main")
+   {
+      const program prog{
+         .functions = {{.label = "main",
+                        .kind = function_kind::e_main,
+                        .blocks = {{.instructions = {{.op = opcode::e_load,
+                                                      .dest = virtual_register{0},
+                                                      .label = "main_x"},
+                                                     {.op = opcode::e_add,
+                                                      .dest = virtual_register{1},
+                                                      .lhs = virtual_register{0},
+                                                      .immediate = "1"},
+                                                     {.op = opcode::e_store,
+                                                      .lhs = virtual_register{1},
+                                                      .label = "main_y"},
+                                                     {.op = opcode::e_halt}}}}}},
+         .data = {{.label = "main_x", .size = 4}, {.label = "main_y", .size = 4}}};
+
+      CHECK(emit_moon(prog) ==
+            "          entry\n"
+            "          addi r14, r0, topaddr\n\n"
+            "          lw r1, main_x(r0)\n"
+            "          addi r1, r1, 1\n"
+            "          sw main_y(r0), r1\n"
+            "          hlt\n\n"
+            "main_x                         res 4\n"
+            "main_y                         res 4\n");
+   }
+   TEST_CASE("labels")
+   {
+      const program prog{
+         .functions = {{.label = "fn_f_1",
+                        .kind = function_kind::e_function,
+                        .blocks = {{.label = "wh_beg_0",
+                                    .instructions = {{.op = opcode::e_load,
+                                                      .dest = virtual_register{0},
+                                                      .label = "f_x"},
+                                                     {.op = opcode::e_branch_zero,
+                                                      .lhs = virtual_register{0},
+                                                      .label = "wh_end_0",
+                                                      .comment = "% while statement"}}},
+                                   {.instructions = {{.op = opcode::e_jump, .label = "wh_beg_0"}}},
+                                   {.label = "wh_end_0",
+                                    .instructions = {{.op = opcode::e_return,
+                                                      .label = "f_callsite0"}}}}}}};
+
+      CHECK(emit_moon(prog) ==
+            "fn_f_1\n"
+            "wh_beg_0  lw r1, f_x(r0)\n"
+            "          bz r1, wh_end_0 % while statement\n"
+            "          j wh_beg_0\n"
+            "wh_end_0  lw r15, f_callsite0(r0)\n"
+            "          jr r15\n\n");
+   }
+   TEST_CASE("values that don't fit in registers are spilled")
+   {
+      // twelve values live at once, one more than the registers given out
+      std::vector<instruction> code;
+      for (std::uint32_t i = 0; i < 12; ++i)
+      {
+         code.push_back(
+            {.op = opcode::e_load_imm, .dest = virtual_register{i}, .immediate = "1"});
+      }
+      for (std::uint32_t i = 0; i < 12; ++i)
+      {
+         code.push_back({.op = opcode::e_store, .lhs = virtual_register{i}, .label = "main_x"});
+      }
+      code.push_back({.op = opcode::e_halt});
+
+      const program prog{
+         .functions = {
+            {.label = "main", .kind = function_kind::e_main, .blocks = {{.instructions = code}}}}};
+
+      const auto output = emit_moon(prog);
+
+      CHECK(output.find("          addi r12, r0, 1\n          sw main_temp0(r0), r12\n") !=
+            std::string::npos);
+      CHECK(output.find("          lw r12, main_temp0(r0)\n          sw main_x(r0), r12\n") !=
+            std::string::npos);
+      CHECK(output.ends_with("main_temp0                     res 4\n"));
+   }
+}
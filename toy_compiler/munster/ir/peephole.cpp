@@ -0,0 +1,301 @@
+/**
+ * @file peephole.cpp
+ * @brief Implement the functions defined at peephole.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/ir/peephole.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+
+namespace munster::ir
+{
+   moon_listing::moon_listing(std::span<const moon_line> lines) : m_lines{lines}
+   {
+      for (std::size_t i = 0; i < std::size(lines); ++i)
+      {
+         if (!std::empty(lines[i].label))
+         {
+            m_label_lines.try_emplace(lines[i].label, i);
+         }
+      }
+   }
+
+   auto moon_listing::lines() const -> std::span<const moon_line> { return m_lines; }
+
+   auto moon_listing::instruction_at(const std::string& label) const -> const moon_line*
+   {
+      const auto it = m_label_lines.find(label);
+      if (it == std::end(m_label_lines))
+      {
+         return nullptr;
+      }
+
+      for (auto i = it->second; i < std::size(m_lines); ++i)
+      {
+         if (!std::empty(m_lines[i].mnemonic))
+         {
+            return &m_lines[i];
+         }
+      }
+
+      return nullptr;
+   }
+
+   namespace
+   {
+      auto is(const moon_line& line, std::string_view mnemonic, std::size_t operand_count) -> bool
+      {
+         return line.mnemonic == mnemonic && std::size(line.operands) == operand_count;
+      }
+
+      /**
+       * @brief The line after `at` if it runs right after it and nothing jumps to it
+       */
+      auto next_unlabeled(const moon_listing& code, std::size_t at) -> const moon_line*
+      {
+         const auto lines = code.lines();
+         if (at + 1 < std::size(lines) && std::empty(lines[at + 1].label) &&
+             !std::empty(lines[at + 1].mnemonic))
+         {
+            return &lines[at + 1];
+         }
+
+         return nullptr;
+      }
+
+      auto parse_immediate(std::string_view text) -> std::optional<std::int32_t>
+      {
+         std::int32_t value = 0;
+         const auto* p_end = text.data() + std::size(text);
+         const auto [p_last, error] = std::from_chars(text.data(), p_end, value);
+         if (error != std::errc{} || p_last != p_end)
+         {
+            return std::nullopt;
+         }
+
+         return value;
+      }
+
+      /**
+       * @brief `sw x(r0), ra` followed by `lw rb, x(r0)`
+       */
+      auto redundant_load(const moon_listing& code, std::size_t at)
+         -> std::optional<peephole_match>
+      {
+         const auto& store = code.lines()[at];
+         const auto* p_load = next_unlabeled(code, at);
+         if (!is(store, "sw", 2) || !p_load || !is(*p_load, "lw", 2) ||
+             p_load->operands[1] != store.operands[0])
+         {
+            return std::nullopt;
+         }
+
+         if (p_load->operands[0] == store.operands[1])
+         {
+            return peephole_match{.length = 2, .replacement = {store}};
+         }
+
+         return peephole_match{
+            .length = 2,
+            .replacement = {store,
+                            {.mnemonic = "add",
+                             .operands = {p_load->operands[0], store.operands[1], "r0"},
+                             .comment = p_load->comment}}};
+      }
+
+      /**
+       * @brief `sub ra, ra, ra` or `addi ra, r0, k` followed by `addi ra, ra, l`
+       */
+      auto merge_immediates(const moon_listing& code, std::size_t at)
+         -> std::optional<peephole_match>
+      {
+         const auto& first = code.lines()[at];
+         const auto* p_add = next_unlabeled(code, at);
+         if (!p_add || !is(*p_add, "addi", 3))
+         {
+            return std::nullopt;
+         }
+
+         const auto& reg = p_add->operands[0];
+         if (p_add->operands[1] != reg)
+         {
+            return std::nullopt;
+         }
+
+         std::optional<std::int32_t> base;
+         if (is(first, "sub", 3) && first.operands[0] == reg && first.operands[1] == reg &&
+             first.operands[2] == reg)
+         {
+            base = 0;
+         }
+         else if (is(first, "addi", 3) && first.operands[0] == reg && first.operands[1] == "r0")
+         {
+            base = parse_immediate(first.operands[2]);
+         }
+
+         const auto offset = parse_immediate(p_add->operands[2]);
+         if (!base || !offset)
+         {
+            return std::nullopt;
+         }
+
+         const auto sum = std::int64_t{*base} + *offset;
+         if (sum < std::numeric_limits<std::int16_t>::min() ||
+             sum > std::numeric_limits<std::int16_t>::max())
+         {
+            return std::nullopt;
+         }
+
+         return peephole_match{.length = 2,
+                               .replacement = {{.label = first.label,
+                                                .mnemonic = "addi",
+                                                .operands = {reg, "r0", std::to_string(sum)},
+                                                .comment = first.comment}}};
+      }
+
+      /**
+       * @brief `j l` where `l` labels one of the lines up to the next instruction
+       */
+      auto jump_to_next(const moon_listing& code, std::size_t at) -> std::optional<peephole_match>
+      {
+         const auto lines = code.lines();
+         const auto& jump = lines[at];
+         if (!is(jump, "j", 1))
+         {
+            return std::nullopt;
+         }
+
+         for (auto i = at + 1; i < std::size(lines); ++i)
+         {
+            if (lines[i].label == jump.operands[0])
+            {
+               if (std::empty(jump.label))
+               {
+                  return peephole_match{.length = 1, .replacement = {}};
+               }
+
+               return peephole_match{.length = 1, .replacement = {{.label = jump.label}}};
+            }
+
+            if (!std::empty(lines[i].mnemonic))
+            {
+               break;
+            }
+         }
+
+         return std::nullopt;
+      }
+
+      /**
+       * @brief `j l` or `bz ra, l` where the code at `l` is `j m`
+       */
+      auto thread_jumps(const moon_listing& code, std::size_t at) -> std::optional<peephole_match>
+      {
+         const auto& jump = code.lines()[at];
+         if (!is(jump, "j", 1) && !is(jump, "bz", 2))
+         {
+            return std::nullopt;
+         }
+
+         const auto& target = jump.operands.back();
+
+         // follow the chain of jumps, leaving the jumps of a cycle as they are
+         auto final_target = target;
+         std::vector<std::string> visited{target};
+         while (const auto* p_next = code.instruction_at(final_target))
+         {
+            if (!is(*p_next, "j", 1))
+            {
+               break;
+            }
+            if (std::ranges::find(visited, p_next->operands[0]) != std::end(visited))
+            {
+               return std::nullopt;
+            }
+
+            final_target = p_next->operands[0];
+            visited.push_back(final_target);
+         }
+
+         if (final_target == target)
+         {
+            return std::nullopt;
+         }
+
+         auto threaded = jump;
+         threaded.operands.back() = final_target;
+
+         return peephole_match{.length = 1, .replacement = {std::move(threaded)}};
+      }
+   } // namespace
+
+   auto default_peephole_rules() -> std::vector<peephole_rule>
+   {
+      return {{.name = "redundant_load", .rewrite = redundant_load},
+              {.name = "merge_immediates", .rewrite = merge_immediates},
+              {.name = "jump_to_next", .rewrite = jump_to_next},
+              {.name = "thread_jumps", .rewrite = thread_jumps}};
+   }
+
+   auto run_peephole(std::vector<moon_line>& code, std::span<const peephole_rule> rules)
+      -> std::vector<std::size_t>
+   {
+      std::vector<std::size_t> fired(std::size(rules));
+
+      for (bool changed = true; changed;)
+      {
+         changed = false;
+
+         const moon_listing listing{code};
+         std::vector<moon_line> rewritten;
+         rewritten.reserve(std::size(code));
+
+         for (std::size_t at = 0; at < std::size(code);)
+         {
+            std::optional<peephole_match> match;
+            for (std::size_t r = 0; r < std::size(rules) && !match; ++r)
+            {
+               match = rules[r].rewrite(listing, at);
+               if (match)
+               {
+                  ++fired[r];
+               }
+            }
+
+            if (match)
+            {
+               rewritten.insert(std::end(rewritten),
+                                std::make_move_iterator(std::begin(match->replacement)),
+                                std::make_move_iterator(std::end(match->replacement)));
+               at += match->length;
+               changed = true;
+            }
+            else
+            {
+               rewritten.push_back(code[at]);
+               ++at;
+            }
+         }
+
+         code = std::move(rewritten);
+      }
+
+      return fired;
+   }
+} // namespace munster::ir
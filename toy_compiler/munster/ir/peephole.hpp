@@ -0,0 +1,94 @@
+/**
+ * @file peephole.hpp
+ * @brief Contains the peephole optimizer rewriting short sequences of emitted Moon code
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <toy_compiler/munster/ir/moon_emitter.hpp>
+#include <toy_compiler/util/flat_hash_map.hpp>
+
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace munster::ir
+{
+   /**
+    * @brief The lines of Moon code a peephole pass reads, along with the line each label is on
+    */
+   class moon_listing
+   {
+   public:
+      explicit moon_listing(std::span<const moon_line> lines);
+
+      [[nodiscard]] auto lines() const -> std::span<const moon_line>;
+
+      /**
+       * @brief The first instruction run from the label, past the lines holding only labels
+       */
+      [[nodiscard]] auto instruction_at(const std::string& label) const -> const moon_line*;
+
+   private:
+      std::span<const moon_line> m_lines;
+      util::flat_hash_map<std::string, std::size_t> m_label_lines;
+   };
+
+   /**
+    * @brief The `length` lines starting at the matched line are replaced by `replacement`
+    */
+   struct peephole_match
+   {
+      std::size_t length;                 // NOLINT
+      std::vector<moon_line> replacement; // NOLINT
+   };
+
+   /**
+    * @brief A named rewrite of the lines starting at line `at` of the listing. A rewrite must keep
+    * the behaviour of the code run from every label it replaces, so that rewrites matched on the
+    * same listing may be applied together
+    */
+   struct peephole_rule
+   {
+      std::string name; // NOLINT
+      std::function<std::optional<peephole_match>(const moon_listing& code, std::size_t at)>
+         rewrite; // NOLINT
+   };
+
+   /**
+    * @brief The rules run when none are given:
+    *
+    * - `redundant_load`: a load of the memory just stored to becomes a copy of the stored
+    *   register, or goes away if it is the same register,
+    * - `merge_immediates`: clearing a register, or setting it to an immediate, followed by adding
+    *   an immediate to it becomes a single `addi` from `r0`,
+    * - `jump_to_next`: a jump to the line right after it goes away,
+    * - `thread_jumps`: a jump or branch to a jump goes to the target of that jump instead.
+    */
+   auto default_peephole_rules() -> std::vector<peephole_rule>;
+
+   /**
+    * @brief Rewrite the code with the rules until none of them matches. At each line the rules
+    * are tried in the order they are given
+    *
+    * @return How many times each rule fired, in the order of the rules
+    */
+   auto run_peephole(std::vector<moon_line>& code, std::span<const peephole_rule> rules)
+      -> std::vector<std::size_t>;
+} // namespace munster::ir
@@ -0,0 +1,133 @@
+/**
+ * @brief Runs tests on functions defined in peephole.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ir/peephole.hpp>
+
+using namespace munster::ir;
+
+namespace
+{
+   auto optimize(std::vector<moon_line> code) -> std::pair<std::string, std::vector<std::size_t>>
+   {
+      const auto rules = default_peephole_rules();
+      const auto fired = run_peephole(code, rules);
+
+      return {format_moon(code), fired};
+   }
+} // namespace
+
+TEST_SUITE("peephole test suite")
+{
+   TEST_CASE("redundant_load")
+   {
+      const auto [code, fired] =
+         optimize({{.mnemonic = "sw", .operands = {"main_temp0(r0)", "r12"}},
+                   {.mnemonic = "lw", .operands = {"r12", "main_temp0(r0)"}},
+                   {.mnemonic = "sw", .operands = {"main_temp1(r0)", "r12"}},
+                   {.mnemonic = "lw", .operands = {"r13", "main_temp1(r0)"}},
+                   {.mnemonic = "sw", .operands = {"main_x(r0)", "r1"}},
+                   {.label = "if_end_0", .mnemonic = "lw", .operands = {"r1", "main_x(r0)"}}});
+
+      CHECK(code ==
+            "          sw main_temp0(r0), r12\n"
+            "          sw main_temp1(r0), r12\n"
+            "          add r13, r12, r0\n"
+            "          sw main_x(r0), r1\n"
+            "if_end_0  lw r1, main_x(r0)\n");
+      CHECK(fired == std::vector<std::size_t>{2, 0, 0, 0});
+   }
+   TEST_CASE("merge_immediates")
+   {
+      const auto [code, fired] =
+         optimize({{.label = "wh_beg_0", .mnemonic = "sub", .operands = {"r1", "r1", "r1"}},
+                   {.mnemonic = "addi", .operands = {"r1", "r1", "4"}},
+                   {.mnemonic = "addi", .operands = {"r1", "r1", "-1"}},
+                   {.mnemonic = "addi", .operands = {"r2", "r0", "32767"}},
+                   {.mnemonic = "addi", .operands = {"r2", "r2", "1"}}});
+
+      CHECK(code ==
+            "wh_beg_0  addi r1, r0, 3\n"
+            "          addi r2, r0, 32767\n"
+            "          addi r2, r2, 1\n");
+      CHECK(fired == std::vector<std::size_t>{0, 2, 0, 0});
+   }
+   TEST_CASE("jump_to_next")
+   {
+      const auto [code, fired] =
+         optimize({{.mnemonic = "j", .operands = {"if_end_0"}},
+                   {.label = "else_0"},
+                   {.label = "if_end_0", .mnemonic = "hlt"},
+                   {.label = "wh_beg_0", .mnemonic = "j", .operands = {"a"}},
+                   {.label = "a", .mnemonic = "hlt"}});
+
+      CHECK(code ==
+            "else_0\n"
+            "if_end_0  hlt\n"
+            "wh_beg_0\n"
+            "a         hlt\n");
+      CHECK(fired == std::vector<std::size_t>{0, 0, 2, 0});
+   }
+   TEST_CASE("thread_jumps")
+   {
+      const auto [code, fired] =
+         optimize({{.mnemonic = "bz", .operands = {"r1", "else_0"}},
+                   {.mnemonic = "hlt"},
+                   {.label = "else_0"},
+                   {.mnemonic = "j", .operands = {"wh_beg_0"}},
+                   {.label = "if_end_0", .mnemonic = "j", .operands = {"else_0"}},
+                   {.label = "wh_beg_0", .mnemonic = "hlt"},
+                   {.label = "a", .mnemonic = "j", .operands = {"b"}},
+                   {.mnemonic = "hlt"},
+                   {.label = "b", .mnemonic = "j", .operands = {"a"}}});
+
+      CHECK(code ==
+            "          bz r1, wh_beg_0\n"
+            "          hlt\n"
+            "else_0\n"
+            "if_end_0\n"
+            "wh_beg_0  hlt\n"
+            "a         j b\n"
+            "          hlt\n"
+            "b         j a\n");
+      CHECK(fired[3] == 2);
+      CHECK(fired[2] == 2);
+   }
+   TEST_CASE("rules are configurable")
+   {
+      std::vector<moon_line> code{{.mnemonic = "j", .operands = {"a"}},
+                                  {.label = "a", .mnemonic = "hlt"}};
+
+      const std::vector<peephole_rule> rules{
+         {.name = "no_halt",
+          .rewrite = [](const moon_listing& listing, std::size_t at)
+             -> std::optional<peephole_match> {
+             if (listing.lines()[at].mnemonic == "hlt")
+             {
+                return peephole_match{.length = 1, .replacement = {}};
+             }
+
+             return std::nullopt;
+          }}};
+
+      CHECK(run_peephole(code, rules) == std::vector<std::size_t>{1});
+      CHECK(std::size(code) == 1);
+   }
+}
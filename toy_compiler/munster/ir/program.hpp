@@ -0,0 +1,153 @@
+/**
+ * @file program.hpp
+ * @brief Contains the three-address intermediate representation the AST is lowered to before
+ * Moon code is emitted
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace munster::ir
+{
+   /**
+    * @brief A value computed by an instruction. Virtual registers are written once and are only
+    * read in the basic block writing them; they are given machine registers when the program is
+    * emitted
+    */
+   enum struct virtual_register : std::uint32_t
+   {
+   };
+
+   enum struct opcode : std::uint8_t
+   {
+      e_load,     // dest <- label
+      e_store,    // label <- lhs
+      e_load_imm, // dest <- immediate
+      e_copy,     // dest <- lhs
+
+      // dest <- lhs op rhs, or lhs op immediate when the instruction has an immediate
+      e_add,
+      e_sub,
+      e_or,
+      e_mul,
+      e_div,
+      e_and,
+      e_eq,
+      e_ne,
+      e_lt,
+      e_gt,
+      e_le,
+      e_ge,
+
+      // terminators, only the last instruction of a basic block may be one
+      e_jump,        // go to the block named label
+      e_branch_zero, // go to the block named label if lhs is 0, to the next block otherwise
+      e_return,      // go to the address stored at label
+      e_halt
+   };
+
+   /**
+    * @brief An operation of the program, the fields it doesn't use are left as is. `immediate`
+    * is the literal as written in the source, empty if there is none, and `label` is either the
+    * memory the instruction works on or the block it goes to
+    */
+   struct instruction
+   {
+      opcode op{};             // NOLINT
+      virtual_register dest{}; // NOLINT
+      virtual_register lhs{};  // NOLINT
+      virtual_register rhs{};  // NOLINT
+      std::string immediate{}; // NOLINT
+      std::string label{};     // NOLINT
+      std::string comment{};   // NOLINT
+   };
+
+   /**
+    * @brief Straight-line instructions, entered only from the top. A block without a label is
+    * only entered from the block before it
+    */
+   struct basic_block
+   {
+      std::string label{};                   // NOLINT
+      std::vector<instruction> instructions; // NOLINT
+   };
+
+   enum struct function_kind : std::uint8_t
+   {
+      e_function,
+      e_main
+   };
+
+   /**
+    * @brief The blocks of a function in the order they are laid out, falling through from one to
+    * the next unless a block ends with a jump
+    */
+   struct function
+   {
+      std::string label;               // NOLINT
+      function_kind kind{};            // NOLINT
+      std::vector<basic_block> blocks; // NOLINT
+   };
+
+   /**
+    * @brief Memory reserved for a variable, a parameter or a temporary
+    */
+   struct reservation
+   {
+      std::string label; // NOLINT
+      std::int64_t size; // NOLINT
+   };
+
+   struct program
+   {
+      std::vector<function> functions; // NOLINT
+      std::vector<reservation> data;   // NOLINT
+   };
+
+   constexpr auto is_terminator(opcode op) -> bool { return op >= opcode::e_jump; }
+   constexpr auto is_arithmetic(opcode op) -> bool
+   {
+      return op >= opcode::e_add && op <= opcode::e_ge;
+   }
+
+   /**
+    * @brief Whether the instruction writes its `dest` register
+    */
+   constexpr auto writes_dest(const instruction& instr) -> bool
+   {
+      return instr.op == opcode::e_load || instr.op == opcode::e_load_imm ||
+         instr.op == opcode::e_copy || is_arithmetic(instr.op);
+   }
+   /**
+    * @brief Whether the instruction reads its `lhs` register
+    */
+   constexpr auto reads_lhs(const instruction& instr) -> bool
+   {
+      return instr.op == opcode::e_store || instr.op == opcode::e_copy ||
+         instr.op == opcode::e_branch_zero || is_arithmetic(instr.op);
+   }
+   /**
+    * @brief Whether the instruction reads its `rhs` register
+    */
+   inline auto reads_rhs(const instruction& instr) -> bool
+   {
+      return is_arithmetic(instr.op) && std::empty(instr.immediate);
+   }
+} // namespace munster::ir
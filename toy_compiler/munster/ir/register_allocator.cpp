@@ -0,0 +1,69 @@
+#include <toy_compiler/munster/ir/register_allocator.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace munster
+{
+   auto linear_scan(std::span<const live_interval> intervals,
+                    std::span<const register_type> registers)
+      -> std::vector<std::optional<register_type>>
+   {
+      std::vector<std::optional<register_type>> assigned(std::size(intervals));
+
+      std::vector<std::size_t> order(std::size(intervals));
+      std::iota(std::begin(order), std::end(order), std::size_t{0});
+      std::ranges::stable_sort(order, {}, [&](std::size_t i) {
+         return intervals[i].start;
+      });
+
+      // the registers not held by an active interval, kept in the order they were given
+      std::vector<std::size_t> free(std::size(registers));
+      std::iota(std::begin(free), std::end(free), std::size_t{0});
+
+      // the intervals holding a register, paired with the index of their register, by end
+      std::vector<std::pair<std::size_t, std::size_t>> active;
+      const auto end_of = [&](const std::pair<std::size_t, std::size_t>& a) {
+         return intervals[a.first].end;
+      };
+
+      for (std::size_t current : order)
+      {
+         const auto start = intervals[current].start;
+
+         const auto expired = std::ranges::find_if(active, [&](const auto& a) {
+            return end_of(a) > start;
+         });
+         for (auto it = std::begin(active); it != expired; ++it)
+         {
+            free.insert(std::ranges::upper_bound(free, it->second), it->second);
+         }
+         active.erase(std::begin(active), expired);
+
+         std::size_t reg = 0;
+         if (!std::empty(free))
+         {
+            reg = free.front();
+            free.erase(std::begin(free));
+         }
+         else if (!std::empty(active) && end_of(active.back()) > intervals[current].end)
+         {
+            // the value kept the longest gives its register up and lives in memory instead
+            reg = active.back().second;
+            assigned[active.back().first] = std::nullopt;
+            active.pop_back();
+         }
+         else
+         {
+            continue;
+         }
+
+         assigned[current] = registers[reg];
+
+         const auto entry = std::pair{current, reg};
+         active.insert(std::ranges::upper_bound(active, intervals[current].end, {}, end_of), entry);
+      }
+
+      return assigned;
+   }
+} // namespace munster
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <magic_enum.hpp>
+
+#include <fmt/core.h>
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace munster
+{
+   enum struct register_type : std::uint8_t
+   {
+      e_r0,
+      e_r1,
+      e_r2,
+      e_r3,
+      e_r4,
+      e_r5,
+      e_r6,
+      e_r7,
+      e_r8,
+      e_r9,
+      e_r10,
+      e_r11,
+      e_r12,
+      e_r13,
+      e_r14,
+      e_r15,
+   };
+
+   /**
+    * @brief The instructions during which a value must be kept, from the one computing it to the
+    * last one reading it
+    */
+   struct live_interval
+   {
+      std::uint32_t start; // NOLINT
+      std::uint32_t end;   // NOLINT
+   };
+
+   /**
+    * @brief Give a register to the value of each interval with a linear scan: the intervals are
+    * walked in order of their start, an interval that ended hands its register back, and when no
+    * register is free the value kept the longest, this one included, is spilled to memory.
+    *
+    * A register freed by an interval ending where another starts is given to the new interval,
+    * so an instruction may write its result over one of its operands. Free registers are handed
+    * out in the order they are given
+    *
+    * @return The register of each interval, in the order the intervals were given, or nothing if
+    * the value of the interval was spilled
+    */
+   auto linear_scan(std::span<const live_interval> intervals,
+                    std::span<const register_type> registers)
+      -> std::vector<std::optional<register_type>>;
+} // namespace munster
+
+template <>
+struct fmt::formatter<munster::register_type>
+{
+   template <typename ParseContex>
+   constexpr auto parse(ParseContex& ctx)
+   {
+      return ctx.begin();
+   }
+
+   template <typename FormatContext>
+   auto format(munster::register_type s, FormatContext& ctx)
+   {
+      return fmt::format_to(ctx.out(), "{}", magic_enum::enum_name(s).substr(2));
+   }
+};
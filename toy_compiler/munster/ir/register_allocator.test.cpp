@@ -0,0 +1,81 @@
+/**
+ * @brief Runs tests on functions defined in register_allocator.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ir/register_allocator.hpp>
+
+#include <array>
+#include <vector>
+
+using munster::linear_scan;
+using munster::live_interval;
+using munster::register_type;
+
+TEST_SUITE("register allocator test suite")
+{
+   TEST_CASE("registers are reused once a value is dead")
+   {
+      const std::array registers{register_type::e_r1, register_type::e_r2};
+
+      // a = x; b = y; c = a + b; d = c * 2
+      const std::vector<live_interval> intervals{{0, 2}, {1, 2}, {2, 3}, {3, 3}};
+      const auto assigned = linear_scan(intervals, registers);
+
+      REQUIRE(std::size(assigned) == 4);
+      CHECK(assigned[0] == register_type::e_r1);
+      CHECK(assigned[1] == register_type::e_r2);
+      // the result may be written over the operands it is computed from
+      CHECK(assigned[2] == register_type::e_r1);
+      CHECK(assigned[3] == register_type::e_r1);
+   }
+   TEST_CASE("the value kept the longest is spilled")
+   {
+      const std::array registers{register_type::e_r1, register_type::e_r2};
+
+      const std::vector<live_interval> intervals{{0, 10}, {1, 4}, {2, 5}, {6, 7}};
+      const auto assigned = linear_scan(intervals, registers);
+
+      CHECK_FALSE(assigned[0]);
+      CHECK(assigned[1] == register_type::e_r2);
+      CHECK(assigned[2] == register_type::e_r1);
+      CHECK(assigned[3] == register_type::e_r1);
+   }
+   TEST_CASE("a value outliving the others is spilled itself")
+   {
+      const std::array registers{register_type::e_r1};
+
+      const std::vector<live_interval> intervals{{0, 3}, {1, 8}};
+      const auto assigned = linear_scan(intervals, registers);
+
+      CHECK(assigned[0] == register_type::e_r1);
+      CHECK_FALSE(assigned[1]);
+   }
+   TEST_CASE("intervals may be given in any order")
+   {
+      const std::array registers{register_type::e_r1, register_type::e_r2};
+
+      const std::vector<live_interval> intervals{{4, 5}, {0, 1}, {1, 4}};
+      const auto assigned = linear_scan(intervals, registers);
+
+      CHECK(assigned[1] == register_type::e_r1);
+      CHECK(assigned[2] == register_type::e_r1);
+      CHECK(assigned[0] == register_type::e_r1);
+   }
+}
@@ -19,623 +19,579 @@
 
 #include <toy_compiler/munster/lexer.hpp>
 
+#include <toy_compiler/munster/scanning.hpp>
+#include <toy_compiler/munster/source_buffer.hpp>
 #include <toy_compiler/munster/utility.hpp>
 
-#include <range/v3/algorithm/count.hpp>
-#include <range/v3/algorithm/find.hpp>
-#include <range/v3/algorithm/replace.hpp>
-#include <range/v3/range/conversion.hpp>
-#include <range/v3/view/replace.hpp>
-#include <range/v3/view/take_while.hpp>
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <limits>
 
-#include <fstream>
-#include <iostream>
-
-namespace vi = ranges::views;
 namespace fs = std::filesystem;
 
-/**
- * @brief All possible keywords of the language
- */
-constexpr std::array keywords{"if",     "then",    "else", "integer",  "float", "string",  "void",
-                              "public", "private", "func", "var",      "class", "while",   "read",
-                              "write",  "return",  "main", "inherits", "break", "continue"};
-
 namespace munster
 {
-   auto lexer(const std::string_view data, source_location pos) -> lex_item;
-   auto trim_leading_whitespaces(const std::string_view data)
-      -> std::tuple<std::string_view, std::uint32_t, std::uint32_t>;
-   auto check_for_newlines(const lex_item& tok) -> std::uint32_t
-   {
-      if (tok.type == grammar::token_type::e_block_cmt)
-      {
-         return static_cast<std::uint32_t>(ranges::count(tok.lexeme, '\n'));
-      }
+   /////////////// KEYWORDS //////////////////
 
-      return 0;
-   }
-   auto cleanup_lexeme(const lex_item& tok) -> std::string
+   struct keyword
    {
-      if (tok.type == grammar::token_type::e_block_cmt)
-      {
-         return to_literal(tok.lexeme);
-      }
-
-      if (tok.type == grammar::token_type::e_line_cmt)
-      {
-         return to_literal(tok.lexeme);
-      }
-
-      if (tok.type == grammar::token_type::e_invalid_cmt)
-      {
-         return to_literal(tok.lexeme);
-      }
-
-      if (tok.type == grammar::token_type::e_str_lit)
-      {
-         return tok.lexeme.substr(1, std::size(tok.lexeme) - 2);
-      }
-
-      return tok.lexeme;
-   }
-
-   auto lex_file(const fs::path& path, util::logger_wrapper log)
-      -> monad::maybe<std::vector<lex_item>>
+      std::string_view name;
+      grammar::token_type type{grammar::token_type::e_id};
+   };
+
+   /**
+    * @brief All possible keywords of the language
+    */
+   constexpr std::array keywords{keyword{"if", grammar::token_type::e_if},
+                                 keyword{"then", grammar::token_type::e_then},
+                                 keyword{"else", grammar::token_type::e_else},
+                                 keyword{"integer", grammar::token_type::e_integer},
+                                 keyword{"float", grammar::token_type::e_float},
+                                 keyword{"string", grammar::token_type::e_string},
+                                 keyword{"void", grammar::token_type::e_void},
+                                 keyword{"public", grammar::token_type::e_public},
+                                 keyword{"private", grammar::token_type::e_private},
+                                 keyword{"func", grammar::token_type::e_func},
+                                 keyword{"var", grammar::token_type::e_var},
+                                 keyword{"class", grammar::token_type::e_class},
+                                 keyword{"while", grammar::token_type::e_while},
+                                 keyword{"read", grammar::token_type::e_read},
+                                 keyword{"write", grammar::token_type::e_write},
+                                 keyword{"return", grammar::token_type::e_return},
+                                 keyword{"main", grammar::token_type::e_main},
+                                 keyword{"inherits", grammar::token_type::e_inherits},
+                                 keyword{"break", grammar::token_type::e_break},
+                                 keyword{"continue", grammar::token_type::e_continue}};
+
+   constexpr std::size_t keyword_table_size = 32;
+   constexpr std::size_t min_keyword_length = 2;
+   constexpr std::size_t max_keyword_length = 8;
+
+   /**
+    * @brief A hash function without collisions over the names of the `keywords`. Only valid for
+    * strings of at least `min_keyword_length` characters
+    */
+   constexpr auto keyword_hash(std::string_view name) -> std::size_t
    {
-      std::ifstream file{path, std::ios::in};
-
-      if (!file.is_open())
-      {
-         return monad::none;
-      }
-
-      log.info("tokenizing file: \"{}\"", path.c_str());
+      const auto first = static_cast<unsigned char>(name[0]);  // NOLINT
+      const auto second = static_cast<unsigned char>(name[1]); // NOLINT
 
-      std::vector<lex_item> tokens;
-
-      // TODO: look into reading file 1 kb at a time
-      std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-
-      auto [char_view, line_counter, column_counter] = trim_leading_whitespaces(content);
-      line_counter += 1;
-      column_counter += 1;
-
-      while (std::size(char_view) != 0)
-      {
-         auto tok = lexer(char_view, {.line = line_counter, .column = column_counter});
-         const auto [data, inc, col] =
-            trim_leading_whitespaces(char_view.substr(std::size(tok.lexeme)));
-         const auto extra = check_for_newlines(tok);
-
-         char_view = data;
-         line_counter += inc + extra;
-
-         if (inc > 0)
-         {
-            column_counter = col + static_cast<std::uint32_t>(std::size(tok.lexeme));
-         }
-         else
-         {
-            column_counter += col + static_cast<std::uint32_t>(std::size(tok.lexeme));
-         }
-
-         if (extra > 0)
-         {
-            column_counter = 0;
-         }
-
-         tok.lexeme = cleanup_lexeme(tok);
-
-         tokens.push_back(tok);
-      }
-
-      log.info("tokenization of file \"{}\" completed", path.c_str());
-
-      tokens.push_back(lex_item{.type = grammar::token_type::e_eof, .lexeme = "$"});
-
-      return tokens;
+      return (7U * first + 18U * second + std::size(name)) % keyword_table_size; // NOLINT
    }
 
-   auto lex_alphanum(const std::string_view data, source_location pos) -> lex_item
+   constexpr auto make_keyword_table() -> std::array<keyword, keyword_table_size>
    {
-      const auto lexeme = data | vi::take_while(is_alphanum) | ranges::to<std::string>;
-
-      if (const auto* it = ranges::find(keywords, lexeme); it != std::end(keywords))
+      std::array<keyword, keyword_table_size> table{};
+      for (const auto& kw : keywords)
       {
-         std::string adjusted = "e_";
-         adjusted.append(*it);
-         return {.type = magic_enum::enum_cast<grammar::token_type>(adjusted).value(),
-                 .lexeme = lexeme,
-                 .pos = pos};
+         table.at(keyword_hash(kw.name)) = kw;
       }
 
-      return {.type = grammar::token_type::e_id, .lexeme = lexeme, .pos = pos};
+      return table;
    }
 
-   auto lex_braces(const std::string_view data, source_location pos) -> lex_item
-   {
-      const char lexeme = data.at(0);
+   constexpr auto keyword_table = make_keyword_table();
 
-      if (lexeme == grammar::open_curly)
-      {
-         return {.type = grammar::token_type::e_left_brace, .lexeme = {lexeme}, .pos = pos};
-      }
-      if (lexeme == grammar::close_curly)
-      {
-         return {.type = grammar::token_type::e_right_brace, .lexeme = {lexeme}, .pos = pos};
-      }
-      if (lexeme == grammar::open_square)
-      {
-         return {.type = grammar::token_type::e_left_square, .lexeme = {lexeme}, .pos = pos};
-      }
-      if (lexeme == grammar::close_square)
-      {
-         return {.type = grammar::token_type::e_right_square, .lexeme = {lexeme}, .pos = pos};
-      }
-      if (lexeme == grammar::open_parenth)
-      {
-         return {.type = grammar::token_type::e_left_paren, .lexeme = {lexeme}, .pos = pos};
-      }
-      if (lexeme == grammar::close_parenth)
-      {
-         return {.type = grammar::token_type::e_right_paren, .lexeme = {lexeme}, .pos = pos};
-      }
+   static_assert(std::ranges::all_of(keywords,
+                                     [](const keyword& kw) {
+                                        return std::size(kw.name) >= min_keyword_length &&
+                                           std::size(kw.name) <= max_keyword_length &&
+                                           keyword_table.at(keyword_hash(kw.name)).name == kw.name;
+                                     }),
+                 "keyword_hash must not have any collisions over the keywords");
 
-      return {.type = grammar::token_type::e_invalid_char, .lexeme = {lexeme}, .pos = pos};
-   }
-
-   auto lex_comments(const std::string_view data, source_location pos) -> lex_item;
-   auto lex_numeric(const std::string_view data, source_location pos) -> lex_item;
-   auto lex_punctuation(const std::string_view data, source_location pos) -> lex_item;
-   auto lex_string(const std::string_view data, source_location pos) -> lex_item;
-   auto lex_operator(const std::string_view data, source_location pos) -> lex_item;
-
-   auto lexer(const std::string_view data, source_location pos) -> lex_item
+   /**
+    * @brief Get the `grammar::token_type` of an identifier, which may be a keyword
+    */
+   constexpr auto lookup_keyword(std::string_view lexeme) -> grammar::token_type
    {
-      if (std::size(data) >= 2 && is_comment(data.substr(0, 2)))
-      {
-         return lex_comments(data, pos);
-      }
-
-      const char first = data.at(0);
-      if (std::isalpha(first))
-      {
-         return lex_alphanum(data, pos);
-      }
-
-      if (is_digit(first))
-      {
-         return lex_numeric(data, pos);
-      }
-
-      if (is_quote(first))
-      {
-         return lex_string(data, pos);
-      }
-
-      if (is_punctuation(first))
-      {
-         return lex_punctuation(data, pos);
-      }
-
-      if (is_braces(first))
-      {
-         return lex_braces(data, pos);
-      }
-
-      if (is_operator(first))
+      if (std::size(lexeme) < min_keyword_length || std::size(lexeme) > max_keyword_length)
       {
-         return lex_operator(data, pos);
+         return grammar::token_type::e_id;
       }
 
-      return {.type = grammar::token_type::e_invalid_char, .lexeme = {first}, .pos = pos};
+      const auto& entry = keyword_table.at(keyword_hash(lexeme));
+      return entry.name == lexeme ? entry.type : grammar::token_type::e_id;
    }
 
-   auto newline_counter(const std::string_view data) -> std::uint32_t
-   {
-      std::uint32_t newline_count = 0;
-      for (char c : data)
-      {
-         if (is_newline(c))
-         {
-            ++newline_count;
-         }
-      }
+   /////////////// DFA //////////////////
 
-      return newline_count;
-   }
-   auto column_counter(const std::string_view data) -> std::uint32_t
+   /**
+    * @brief The states of the lexer's DFA. Follows resources/diagrams/dfa_*.dot
+    *
+    * Every state starting at `e_final` ends the lexing of a token.
+    */
+   enum struct lexer_state : std::uint8_t
    {
-      std::uint32_t column_index = 0;
-      for (char c : data)
-      {
-         if (is_newline(c))
-         {
-            column_index = 0;
-         }
-         else
-         {
-            ++column_index;
-         }
-      }
-
-      return column_index;
+      e_start,
+      e_id,
+      e_zero,
+      e_integer,
+      e_fraction_start,
+      e_fraction_zero,
+      e_fraction,
+      e_fraction_trailing_zero,
+      e_exponent,
+      e_exponent_sign,
+      e_exponent_zero,
+      e_exponent_integer,
+      e_string,
+      e_invalid_string,
+      e_slash,
+      e_line_comment,
+      e_block_comment,
+      e_block_comment_star,
+      e_colon,
+      e_equal,
+      e_less_than,
+      e_greater_than,
+
+      e_final,
+      e_final_id = e_final,
+      e_final_integer,
+      e_final_float,
+      e_final_float_trailing_zero,
+      e_final_invalid_num,
+      e_final_str,
+      e_final_invalid_str,
+      e_final_unterminated_str,
+      e_final_line_cmt,
+      e_final_block_cmt,
+      e_final_invalid_cmt,
+      e_final_dot,
+      e_final_comma,
+      e_final_colon,
+      e_final_double_colon,
+      e_final_semi_colon,
+      e_final_plus,
+      e_final_minus,
+      e_final_mult,
+      e_final_div,
+      e_final_assign,
+      e_final_equal,
+      e_final_less_than,
+      e_final_less_equal_than,
+      e_final_not_equal,
+      e_final_greater_than,
+      e_final_greater_equal_than,
+      e_final_or,
+      e_final_and,
+      e_final_not,
+      e_final_qmark,
+      e_final_left_paren,
+      e_final_right_paren,
+      e_final_left_square,
+      e_final_right_square,
+      e_final_left_brace,
+      e_final_right_brace,
+      e_final_invalid_char,
+      e_max_size
+   };
+
+   constexpr auto to_index(lexer_state state) -> std::size_t
+   {
+      return static_cast<std::size_t>(state);
    }
-   auto trim_leading_whitespaces(const std::string_view data)
-      -> std::tuple<std::string_view, std::uint32_t, std::uint32_t>
+   constexpr auto to_index(char_class type) -> std::size_t
    {
-      const std::size_t first = data.find_first_not_of(" \n\f\r\t\v");
-
-      return {data.substr(std::min(first, std::size(data))), newline_counter(data.substr(0, first)),
-              column_counter(data.substr(0, first))};
+      return static_cast<std::size_t>(type);
    }
+   constexpr auto is_final(lexer_state state) -> bool { return state >= lexer_state::e_final; }
 
-   /////////////// NUMBERS //////////////////
-
-   auto handle_leading_zero(const std::string_view, source_location) -> lex_item;
-   auto handle_leading_nonzero(const std::string_view, source_location) -> lex_item;
-   auto handle_fraction(const std::string_view, source_location) -> lex_item;
-
-   auto lex_numeric(const std::string_view data, source_location pos) -> lex_item
+   /**
+    * @brief Information on the token produced when a final state is reached.
+    */
+   struct final_state
    {
-      if (data.at(0) == '0')
-      {
-         return handle_leading_zero(data, pos);
-      }
+      grammar::token_type type{};
+      /**
+       * @brief Added to the index of the character that led to the final state to get the length
+       * of the lexeme. 1 if the character is part of the lexeme, 0 if it was only a lookahead and
+       * -1 if the character before it must also be given back (trailing zero of a fraction)
+       */
+      std::int32_t length_offset{};
+   };
+
+   constexpr std::size_t final_state_count = to_index(lexer_state::e_max_size) -
+      to_index(lexer_state::e_final);
+
+   constexpr auto make_final_states() -> std::array<final_state, final_state_count>
+   {
+      using grammar::token_type;
 
-      return handle_leading_nonzero(data, pos);
-   }
+      std::array<final_state, final_state_count> states{};
 
-   auto handle_leading_zero(const std::string_view data, source_location pos) -> lex_item
-   {
-      const char first = data.at(0);
-      if (std::size(data) > 1)
-      {
-         const char second = data.at(1);
-         if (second == grammar::period)
-         {
-            const auto float_token = handle_fraction(data.substr(1), pos);
-            return {.type = float_token.type,
-                    .lexeme = first + float_token.lexeme,
-                    .pos = float_token.pos};
-         }
-      }
+      const auto set = [&](lexer_state state, token_type type, std::int32_t offset) {
+         states.at(to_index(state) - to_index(lexer_state::e_final)) = {type, offset};
+      };
 
-      return {.type = grammar::token_type::e_integer_lit, .lexeme = {first}, .pos = pos};
+      set(lexer_state::e_final_id, token_type::e_id, 0);
+      set(lexer_state::e_final_integer, token_type::e_integer_lit, 0);
+      set(lexer_state::e_final_float, token_type::e_float_lit, 0);
+      set(lexer_state::e_final_float_trailing_zero, token_type::e_float_lit, -1);
+      set(lexer_state::e_final_invalid_num, token_type::e_invalid_num, 0);
+      set(lexer_state::e_final_str, token_type::e_str_lit, 1);
+      set(lexer_state::e_final_invalid_str, token_type::e_invalid_str, 1);
+      set(lexer_state::e_final_unterminated_str, token_type::e_invalid_str, 0);
+      set(lexer_state::e_final_line_cmt, token_type::e_line_cmt, 0);
+      set(lexer_state::e_final_block_cmt, token_type::e_block_cmt, 1);
+      set(lexer_state::e_final_invalid_cmt, token_type::e_invalid_cmt, 0);
+      set(lexer_state::e_final_dot, token_type::e_dot, 1);
+      set(lexer_state::e_final_comma, token_type::e_comma, 1);
+      set(lexer_state::e_final_colon, token_type::e_colon, 0);
+      set(lexer_state::e_final_double_colon, token_type::e_double_colon, 1);
+      set(lexer_state::e_final_semi_colon, token_type::e_semi_colon, 1);
+      set(lexer_state::e_final_plus, token_type::e_plus, 1);
+      set(lexer_state::e_final_minus, token_type::e_minus, 1);
+      set(lexer_state::e_final_mult, token_type::e_mult, 1);
+      set(lexer_state::e_final_div, token_type::e_div, 0);
+      set(lexer_state::e_final_assign, token_type::e_assign, 0);
+      set(lexer_state::e_final_equal, token_type::e_equal, 1);
+      set(lexer_state::e_final_less_than, token_type::e_less_than, 0);
+      set(lexer_state::e_final_less_equal_than, token_type::e_less_equal_than, 1);
+      set(lexer_state::e_final_not_equal, token_type::e_not_equal, 1);
+      set(lexer_state::e_final_greater_than, token_type::e_greater_thane, 0);
+      set(lexer_state::e_final_greater_equal_than, token_type::e_greater_equal_than, 1);
+      set(lexer_state::e_final_or, token_type::e_or, 1);
+      set(lexer_state::e_final_and, token_type::e_and, 1);
+      set(lexer_state::e_final_not, token_type::e_not, 1);
+      set(lexer_state::e_final_qmark, token_type::e_qmark, 1);
+      set(lexer_state::e_final_left_paren, token_type::e_left_paren, 1);
+      set(lexer_state::e_final_right_paren, token_type::e_right_paren, 1);
+      set(lexer_state::e_final_left_square, token_type::e_left_square, 1);
+      set(lexer_state::e_final_right_square, token_type::e_right_square, 1);
+      set(lexer_state::e_final_left_brace, token_type::e_left_brace, 1);
+      set(lexer_state::e_final_right_brace, token_type::e_right_brace, 1);
+      set(lexer_state::e_final_invalid_char, token_type::e_invalid_char, 1);
+
+      return states;
    }
-   auto handle_leading_nonzero(const std::string_view data, source_location pos) -> lex_item
-   {
-      const auto lexeme = data | vi::take_while(is_digit) | ranges::to<std::string>;
-      const auto* const last = std::begin(data) + std::size(lexeme);
 
-      if (last != std::end(data) && *last == grammar::period)
-      {
-         const auto float_token = handle_fraction(data.substr(std::size(lexeme)), pos);
-         return {.type = float_token.type,
-                 .lexeme = lexeme + float_token.lexeme,
-                 .pos = float_token.pos};
-      }
+   constexpr auto final_states = make_final_states();
 
-      return {.type = grammar::token_type::e_integer_lit, .lexeme = lexeme, .pos = pos};
-   }
-   auto handle_scientific_notation(const std::string_view data, source_location pos) -> lex_item
+   using transition_table =
+      std::array<std::array<lexer_state, to_index(char_class::e_max_size)>,
+                 to_index(lexer_state::e_final)>;
+
+   constexpr auto make_transition_table() -> transition_table
    {
-      const auto convert = [](const lex_item& tok) {
-         return tok.type != grammar::token_type::e_invalid_num ? grammar::token_type::e_float_lit
-                                                               : tok.type;
-      };
+      using state = lexer_state;
+      using cc = char_class;
 
-      const auto first = data.at(0);
-      if (first == '+' || first == '-')
-      {
-         const auto second = data.at(1);
-         if (second == '0')
-         {
-            const auto integer = handle_leading_zero(data.substr(1), pos);
-            return {.type = convert(integer), .lexeme = first + integer.lexeme, .pos = pos};
-         }
+      transition_table table{};
 
-         if (is_digit(second))
+      const auto otherwise = [&](state from, state to) {
+         table.at(to_index(from)).fill(to);
+      };
+      const auto on = [&](state from, std::initializer_list<cc> types, state to) {
+         for (const auto type : types)
          {
-            const auto integer = handle_leading_nonzero(data.substr(1), pos);
-            return {.type = convert(integer), .lexeme = first + integer.lexeme, .pos = pos};
+            table.at(to_index(from)).at(to_index(type)) = to;
          }
+      };
 
-         return {.type = grammar::token_type::e_invalid_num, .lexeme = {first}, .pos = pos};
-      }
+      const std::initializer_list<cc> letters = {cc::e_letter, cc::e_letter_e};
+      const std::initializer_list<cc> digits = {cc::e_zero, cc::e_nonzero_digit};
+      const std::initializer_list<cc> alphanums = {cc::e_letter, cc::e_letter_e, cc::e_zero,
+                                                   cc::e_nonzero_digit, cc::e_underscore};
+
+      // dfa_main.dot, dfa_punct.dot, dfa_operator.dot & dfa_braces.dot entry points
+
+      otherwise(state::e_start, state::e_final_invalid_char);
+      on(state::e_start, letters, state::e_id);
+      on(state::e_start, {cc::e_zero}, state::e_zero);
+      on(state::e_start, {cc::e_nonzero_digit}, state::e_integer);
+      on(state::e_start, {cc::e_quote}, state::e_string);
+      on(state::e_start, {cc::e_slash}, state::e_slash);
+      on(state::e_start, {cc::e_period}, state::e_final_dot);
+      on(state::e_start, {cc::e_comma}, state::e_final_comma);
+      on(state::e_start, {cc::e_colon}, state::e_colon);
+      on(state::e_start, {cc::e_semi_colon}, state::e_final_semi_colon);
+      on(state::e_start, {cc::e_plus}, state::e_final_plus);
+      on(state::e_start, {cc::e_minus}, state::e_final_minus);
+      on(state::e_start, {cc::e_star}, state::e_final_mult);
+      on(state::e_start, {cc::e_equal}, state::e_equal);
+      on(state::e_start, {cc::e_less_than}, state::e_less_than);
+      on(state::e_start, {cc::e_greater_than}, state::e_greater_than);
+      on(state::e_start, {cc::e_pipe}, state::e_final_or);
+      on(state::e_start, {cc::e_ampersand}, state::e_final_and);
+      on(state::e_start, {cc::e_exclamation}, state::e_final_not);
+      on(state::e_start, {cc::e_qmark}, state::e_final_qmark);
+      on(state::e_start, {cc::e_open_parenth}, state::e_final_left_paren);
+      on(state::e_start, {cc::e_close_parenth}, state::e_final_right_paren);
+      on(state::e_start, {cc::e_open_square}, state::e_final_left_square);
+      on(state::e_start, {cc::e_close_square}, state::e_final_right_square);
+      on(state::e_start, {cc::e_open_curly}, state::e_final_left_brace);
+      on(state::e_start, {cc::e_close_curly}, state::e_final_right_brace);
+
+      // identifiers
+
+      otherwise(state::e_id, state::e_final_id);
+      on(state::e_id, alphanums, state::e_id);
+
+      // integers & floats
+
+      otherwise(state::e_zero, state::e_final_integer);
+      on(state::e_zero, {cc::e_period}, state::e_fraction_start);
+
+      otherwise(state::e_integer, state::e_final_integer);
+      on(state::e_integer, digits, state::e_integer);
+      on(state::e_integer, {cc::e_period}, state::e_fraction_start);
+
+      otherwise(state::e_fraction_start, state::e_final_invalid_num);
+      on(state::e_fraction_start, {cc::e_zero}, state::e_fraction_zero);
+      on(state::e_fraction_start, {cc::e_nonzero_digit}, state::e_fraction);
+
+      otherwise(state::e_fraction_zero, state::e_final_float);
+      on(state::e_fraction_zero, {cc::e_nonzero_digit}, state::e_fraction);
+      on(state::e_fraction_zero, {cc::e_letter_e}, state::e_exponent);
+
+      otherwise(state::e_fraction, state::e_final_float);
+      on(state::e_fraction, {cc::e_nonzero_digit}, state::e_fraction);
+      on(state::e_fraction, {cc::e_zero}, state::e_fraction_trailing_zero);
+      on(state::e_fraction, {cc::e_letter_e}, state::e_exponent);
+
+      otherwise(state::e_fraction_trailing_zero, state::e_final_float_trailing_zero);
+      on(state::e_fraction_trailing_zero, {cc::e_nonzero_digit}, state::e_fraction);
+      on(state::e_fraction_trailing_zero, {cc::e_zero}, state::e_fraction_trailing_zero);
+      on(state::e_fraction_trailing_zero, {cc::e_letter_e}, state::e_exponent);
+
+      otherwise(state::e_exponent, state::e_final_invalid_num);
+      on(state::e_exponent, {cc::e_plus, cc::e_minus}, state::e_exponent_sign);
+      on(state::e_exponent, {cc::e_zero}, state::e_exponent_zero);
+      on(state::e_exponent, {cc::e_nonzero_digit}, state::e_exponent_integer);
+
+      otherwise(state::e_exponent_sign, state::e_final_invalid_num);
+      on(state::e_exponent_sign, {cc::e_zero}, state::e_exponent_zero);
+      on(state::e_exponent_sign, {cc::e_nonzero_digit}, state::e_exponent_integer);
+
+      otherwise(state::e_exponent_zero, state::e_final_float);
+      on(state::e_exponent_zero, {cc::e_period}, state::e_fraction_start);
+
+      otherwise(state::e_exponent_integer, state::e_final_float);
+      on(state::e_exponent_integer, digits, state::e_exponent_integer);
+      on(state::e_exponent_integer, {cc::e_period}, state::e_fraction_start);
+
+      // strings
+
+      otherwise(state::e_string, state::e_invalid_string);
+      on(state::e_string, alphanums, state::e_string);
+      on(state::e_string, {cc::e_space}, state::e_string);
+      on(state::e_string, {cc::e_quote}, state::e_final_str);
+      on(state::e_string, {cc::e_newline, cc::e_eof}, state::e_final_unterminated_str);
+
+      otherwise(state::e_invalid_string, state::e_invalid_string);
+      on(state::e_invalid_string, {cc::e_quote}, state::e_final_invalid_str);
+      on(state::e_invalid_string, {cc::e_newline, cc::e_eof}, state::e_final_unterminated_str);
+
+      // comments
+
+      otherwise(state::e_slash, state::e_final_div);
+      on(state::e_slash, {cc::e_slash}, state::e_line_comment);
+      on(state::e_slash, {cc::e_star}, state::e_block_comment);
+
+      otherwise(state::e_line_comment, state::e_line_comment);
+      on(state::e_line_comment, {cc::e_newline, cc::e_eof}, state::e_final_line_cmt);
+
+      otherwise(state::e_block_comment, state::e_block_comment);
+      on(state::e_block_comment, {cc::e_star}, state::e_block_comment_star);
+      on(state::e_block_comment, {cc::e_eof}, state::e_final_invalid_cmt);
+
+      otherwise(state::e_block_comment_star, state::e_block_comment);
+      on(state::e_block_comment_star, {cc::e_star}, state::e_block_comment_star);
+      on(state::e_block_comment_star, {cc::e_slash}, state::e_final_block_cmt);
+      on(state::e_block_comment_star, {cc::e_eof}, state::e_final_invalid_cmt);
+
+      // punctuation & operators
+
+      otherwise(state::e_colon, state::e_final_colon);
+      on(state::e_colon, {cc::e_colon}, state::e_final_double_colon);
+
+      otherwise(state::e_equal, state::e_final_assign);
+      on(state::e_equal, {cc::e_equal}, state::e_final_equal);
 
-      if (first == '0')
-      {
-         const auto integer = handle_leading_zero(data, pos);
-         return {.type = convert(integer), .lexeme = integer.lexeme, .pos = pos};
-      }
+      otherwise(state::e_less_than, state::e_final_less_than);
+      on(state::e_less_than, {cc::e_equal}, state::e_final_less_equal_than);
+      on(state::e_less_than, {cc::e_greater_than}, state::e_final_not_equal);
 
-      if (is_digit(first))
-      {
-         const auto integer = handle_leading_nonzero(data, pos);
-         return {.type = convert(integer), .lexeme = integer.lexeme, .pos = pos};
-      }
+      otherwise(state::e_greater_than, state::e_final_greater_than);
+      on(state::e_greater_than, {cc::e_equal}, state::e_final_greater_equal_than);
 
-      return {.type = grammar::token_type::e_invalid_num, .lexeme = {first}, .pos = pos};
+      return table;
    }
-   auto handle_fraction_nonzero(const std::string_view data, source_location pos) -> lex_item
-   {
-      const auto lexeme = data | vi::take_while(is_digit) | ranges::to<std::string>;
-
-      const auto* lexeme_end = std::begin(data) + std::size(lexeme);
-      if ((lexeme_end != std::end(data)) && (*lexeme_end == 'e'))
-      {
-         auto scientific = handle_scientific_notation(data.substr(std::size(lexeme) + 1), pos);
-         scientific.lexeme = '.' + lexeme + *lexeme_end + scientific.lexeme;
-
-         return scientific;
-      }
 
-      const auto last = std::end(lexeme) - 1;
-      if (*last == '0')
-      {
-         return {.type = grammar::token_type::e_float_lit,
-                 .lexeme = "." + std::string{std::begin(lexeme), last},
-                 .pos = pos};
-      }
+   constexpr auto transitions = make_transition_table();
 
-      return {.type = grammar::token_type::e_float_lit, .lexeme = "." + lexeme, .pos = pos};
-   }
-   auto handle_fraction_leading_zero(const std::string_view data, source_location pos) -> lex_item
+   /**
+    * @brief The type & length of a lexeme found at the start of some data
+    */
+   struct scanned_token
    {
-      if (std::size(data) > 1) // only 0
+      grammar::token_type type{};
+      std::size_t length{};
+      std::uint32_t newlines{}; // newlines contained in the lexeme of a block comment
+   };
+
+   /**
+    * @brief Run the DFA over `data` until a final state is reached
+    *
+    * The bodies of comments are skipped over with the vectorized functions of scanning.hpp, the
+    * DFA only handles the characters that may end them.
+    *
+    * @param [in] data The data to lex, starting with the first character of the token
+    */
+   auto lexer(const std::string_view data) -> scanned_token
+   {
+      std::uint32_t newlines = 0;
+
+      auto state = lexer_state::e_start;
+      for (std::size_t index = 0;; ++index)
       {
-         const char second = data.at(1);
-         if (second != '0')
+         if (state == lexer_state::e_block_comment)
          {
-            if (is_digit(second))
-            {
-               return handle_fraction_nonzero(data, pos);
-            }
-
-            if (second == 'e')
-            {
-               auto scientific = handle_scientific_notation(data.substr(2), pos);
-               scientific.lexeme = ".0e" + scientific.lexeme;
+            const auto scan = scan_block_comment(data.substr(index));
 
-               return scientific;
-            }
+            newlines += scan.newlines;
+            index = scan.terminator == std::string_view::npos ? std::size(data)
+                                                              : index + scan.terminator;
          }
-      }
-
-      return {.type = grammar::token_type::e_float_lit, .lexeme = ".0", .pos = pos};
-   }
-   auto handle_fraction(const std::string_view data, source_location pos) -> lex_item
-   {
-      const char period = *std::begin(data);
-      const auto* const first = std::begin(data) + 1;
-
-      if (std::size(data) > 1) // if nothing after period
-      {
-         if (*first == '0')
+         else if (state == lexer_state::e_line_comment)
          {
-            return handle_fraction_leading_zero(data.substr(1), pos);
+            index = std::min(data.find('\n', index), std::size(data));
          }
 
-         if (is_digit(*first))
+         const auto type = index < std::size(data) ? classify(data[index]) : char_class::e_eof;
+         if (state == lexer_state::e_block_comment_star && type == char_class::e_newline)
          {
-            return handle_fraction_nonzero(data.substr(1), pos);
+            ++newlines;
          }
-      }
 
-      return {.type = grammar::token_type::e_invalid_num, .lexeme = {period}, .pos = pos};
-   }
+         state = transitions[to_index(state)][to_index(type)]; // NOLINT
+         if (is_final(state))
+         {
+            const auto& info = final_states[to_index(state) - to_index(lexer_state::e_final)];
+            const auto length = static_cast<std::size_t>(static_cast<std::int64_t>(index) +
+                                                         info.length_offset);
 
-   /////////////// COMMENTS //////////////////
+            if (state == lexer_state::e_final_id)
+            {
+               return {.type = lookup_keyword(data.substr(0, length)), .length = length};
+            }
 
-   auto lex_comments(const std::string_view data, source_location pos) -> lex_item
-   {
-      const auto start = data.substr(0, 2);
-      if (start == "/*")
-      {
-         const auto str_pos = data.find("*/");
-         if (str_pos != std::string_view::npos)
-         {
-            return {.type = grammar::token_type::e_block_cmt,
-                    .lexeme = std::string{data.substr(0, str_pos + 2)},
-                    .pos = pos};
-         }
+            if (state == lexer_state::e_final_block_cmt)
+            {
+               return {.type = info.type, .length = length, .newlines = newlines};
+            }
 
-         return {
-            .type = grammar::token_type::e_invalid_cmt, .lexeme = std::string{data}, .pos = pos};
+            return {.type = info.type, .length = length};
+         }
       }
-
-      return {.type = grammar::token_type::e_line_cmt,
-              .lexeme = std::string{data.substr(0, data.find_first_of('\n'))},
-              .pos = pos};
    }
 
-   /////////////// PUNCTUATION //////////////////
-
-   auto handle_colon(std::string_view data, source_location pos) -> lex_item
+   token_stream::token_stream(std::string_view source) : m_source{source}
    {
-      const auto lexeme = data.substr(0, std::min(data.find_first_not_of(':'), std::size(data)));
-
-      if (std::size(lexeme) >= 2)
-      {
-         return {.type = grammar::token_type::e_double_colon,
-                 .lexeme = {std::begin(lexeme), std::begin(lexeme) + 2},
-                 .pos = pos};
-      }
+      const auto leading = scan_whitespaces(source);
 
-      return {.type = grammar::token_type::e_colon, .lexeme = std::string{lexeme}, .pos = pos};
+      m_remaining = source.substr(leading.length);
+      m_line = leading.newlines + 1;
+      m_column = leading.column + 1;
    }
 
-   auto lex_punctuation(const std::string_view data, source_location pos) -> lex_item
+   auto token_stream::next() -> lex_item
    {
-      // NOLINTNEXTLINE
-      assert(is_punctuation(data.at(0)) && "first character must be a punctuation symbol");
-
-      const char first = data.at(0);
-
-      if (first == grammar::period)
+      if (m_pending_length == 0)
       {
-         return {.type = grammar::token_type::e_dot, .lexeme = {first}, .pos = pos};
-      }
+         if (std::empty(m_remaining))
+         {
+            return lex_item{.type = grammar::token_type::e_eof,
+                            .offset = static_cast<std::uint32_t>(std::size(m_source))};
+         }
 
-      if (first == grammar::comma)
-      {
-         return {.type = grammar::token_type::e_comma, .lexeme = {first}, .pos = pos};
+         lex_next_lexeme();
       }
 
-      if (first == grammar::semi_colon)
-      {
-         return {.type = grammar::token_type::e_semi_colon, .lexeme = {first}, .pos = pos};
-      }
+      // lexemes too long to be referred to by a single lex_item are split in multiple items
+      const auto length = std::min<std::size_t>(m_pending_length, max_lexeme_length);
+      const auto item = lex_item{.type = m_pending_type,
+                                 .length = static_cast<std::uint32_t>(length),
+                                 .offset = static_cast<std::uint32_t>(m_pending_offset),
+                                 .pos = m_pending_pos};
 
-      if (first == grammar::colon)
-      {
-         return handle_colon(data, pos);
-      }
+      m_pending_offset += length;
+      m_pending_length -= length;
 
-      return {.type = grammar::token_type::e_invalid_char, .lexeme{first}, .pos = pos};
+      return item;
    }
 
-   /////////// STRING TOKENIZATION //////////////
+   auto token_stream::source() const noexcept -> std::string_view { return m_source; }
 
-   auto handle_terminated_string(const std::string_view data, source_location pos) -> lex_item
+   void token_stream::lex_next_lexeme()
    {
-      // clang-format off
-      const auto lexeme = data 
-         | vi::take_while([](char c) { return is_alphanum(c) || (c == ' '); }) 
-         | ranges::to<std::string>;
-      // clang-format on
+      const auto tok = lexer(m_remaining);
 
-      if (std::size(lexeme) == std::size(data))
-      {
-         return {.type = grammar::token_type::e_str_lit,
-                 .lexeme = '\"' + std::string{data} + '\"',
-                 .pos = pos};
-      }
+      m_pending_type = tok.type;
+      m_pending_offset = std::size(m_source) - std::size(m_remaining);
+      m_pending_length = tok.length;
+      m_pending_pos = source_location{.line = m_line, .column = m_column};
 
-      return {.type = grammar::token_type::e_invalid_str,
-              .lexeme = '\"' + std::string{data} + '\"',
-              .pos = pos};
-   }
+      const auto trailing = scan_whitespaces(m_remaining.substr(tok.length));
 
-   auto lex_string(const std::string_view data, source_location pos) -> lex_item
-   {
-      // NOLINTNEXTLINE
-      assert(data.at(0) == '\"' && "first character must be a quotation mark (\")");
+      m_remaining = m_remaining.substr(tok.length + trailing.length);
+      m_line += trailing.newlines + tok.newlines;
 
-      const auto next_newline = data.substr(1).find_first_of('\n');
-      const auto next_quotation_mark = data.substr(1).find_first_of('\"');
-
-      if (next_newline >= next_quotation_mark && next_quotation_mark != std::string_view::npos)
+      if (trailing.newlines > 0)
       {
-         return handle_terminated_string(data.substr(1, next_quotation_mark), pos);
-      }
-
-      return {.type = grammar::token_type::e_invalid_str,
-              .lexeme = std::string{data.substr(0, next_newline + 1)},
-              .pos = pos};
-   }
-
-   /////////// OPERATORS //////////////
-
-   auto handle_leading_less_than(const std::string_view data, source_location pos) -> lex_item
-   {
-      if (std::size(data) > 1)
-      {
-         if (data.at(1) == '=')
-         {
-            return {.type = grammar::token_type::e_less_equal_than,
-                    .lexeme = std::string{data.substr(0, 2)},
-                    .pos = pos};
-         }
-
-         if (data.at(1) == '>')
-         {
-            return {.type = grammar::token_type::e_not_equal,
-                    .lexeme = std::string{data.substr(0, 2)},
-                    .pos = pos};
-         }
+         m_column = trailing.column + static_cast<std::uint32_t>(tok.length);
       }
-
-      return {.type = grammar::token_type::e_less_than, .lexeme = {data.at(0)}, .pos = pos};
-   }
-   auto handle_leading_greater_than(const std::string_view data, source_location pos) -> lex_item
-   {
-      if (std::size(data) > 1 && data.at(1) == '=')
+      else
       {
-         return {.type = grammar::token_type::e_greater_equal_than,
-                 .lexeme = std::string{data.substr(0, 2)},
-                 .pos = pos};
+         m_column += trailing.column + static_cast<std::uint32_t>(tok.length);
       }
 
-      return {.type = grammar::token_type::e_greater_thane, .lexeme = {data.at(0)}, .pos = pos};
-   }
-   auto handle_leading_equal(const std::string_view data, source_location pos) -> lex_item
-   {
-      if (std::size(data) > 1 && data.at(1) == '=')
+      if (tok.newlines > 0)
       {
-         return {.type = grammar::token_type::e_equal,
-                 .lexeme = std::string{data.substr(0, 2)},
-                 .pos = pos};
+         m_column = 0;
       }
-
-      return {.type = grammar::token_type::e_assign, .lexeme = {data.at(0)}, .pos = pos};
    }
 
-   auto lex_operator(const std::string_view data, source_location pos) -> lex_item
+   auto make_token_stream(std::string_view source, util::logger_wrapper log)
+      -> monad::maybe<token_stream>
    {
-      const auto first = data.at(0);
-      if (first == '+')
-      {
-         return {.type = grammar::token_type::e_plus, .lexeme = {first}, .pos = pos};
-      }
-
-      if (first == '-')
+      if (std::size(source) > std::numeric_limits<std::uint32_t>::max())
       {
-         return {.type = grammar::token_type::e_minus, .lexeme = {first}, .pos = pos};
-      }
+         log.error("source of {} bytes is too large to be tokenized", std::size(source));
 
-      if (first == '*')
-      {
-         return {.type = grammar::token_type::e_mult, .lexeme = {first}, .pos = pos};
-      }
-
-      if (first == '/')
-      {
-         return {.type = grammar::token_type::e_div, .lexeme = {first}, .pos = pos};
+         return monad::none;
       }
 
-      if (first == '|')
-      {
-         return {.type = grammar::token_type::e_or, .lexeme = {first}, .pos = pos};
-      }
+      return token_stream{source};
+   }
 
-      if (first == '&')
+   auto lex_file(const fs::path& path, util::logger_wrapper log) -> monad::maybe<lex_result>
+   {
+      auto buffer = open_source_buffer(path);
+      if (!buffer)
       {
-         return {.type = grammar::token_type::e_and, .lexeme = {first}, .pos = pos};
+         return monad::none;
       }
 
-      if (first == '!')
+      auto stream = make_token_stream(buffer->view(), log);
+      if (!stream)
       {
-         return {.type = grammar::token_type::e_not, .lexeme = {first}, .pos = pos};
+         return monad::none;
       }
 
-      if (first == '?')
-      {
-         return {.type = grammar::token_type::e_qmark, .lexeme = {first}, .pos = pos};
-      }
+      log.info("tokenizing file: \"{}\"", path.c_str());
 
-      if (first == '<')
+      std::vector<lex_item> tokens{stream->next()};
+      while (!grammar::is_eof(tokens.back().type))
       {
-         return handle_leading_less_than(data, pos);
+         tokens.push_back(stream->next());
       }
 
-      if (first == '>')
-      {
-         return handle_leading_greater_than(data, pos);
-      }
+      log.info("tokenization of file \"{}\" completed", path.c_str());
 
-      return handle_leading_equal(data, pos);
+      return lex_result{.source = std::move(buffer.value()), .items = std::move(tokens)};
    }
 } // namespace munster
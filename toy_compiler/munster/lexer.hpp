@@ -20,38 +20,139 @@
 #pragma once
 
 #include <toy_compiler/munster/grammar/token_type.hpp>
+#include <toy_compiler/munster/source_buffer.hpp>
 #include <toy_compiler/munster/source_location.hpp>
 #include <toy_compiler/util/logger.hpp>
 
 #include <monads/maybe.hpp>
 
 #include <filesystem>
+#include <string_view>
 #include <vector>
 
 namespace munster
 {
    /**
     * @brief Holds a the information of a parsed token.
+    *
+    * The lexeme of the token is not stored, only its location within the source it was lexed
+    * from. Use `munster::lexeme` to access it.
     */
    struct lex_item
    {
-      grammar::token_type type{}; // NOLINT
-      std::string lexeme{};       // NOLINT
-      source_location pos{};      // NOLINT
+      grammar::token_type type : 8 {}; // NOLINT
+      std::uint32_t length : 24 {};    // NOLINT
+      std::uint32_t offset{};          // NOLINT
+      source_location pos{};           // NOLINT
 
       auto operator<=>(const lex_item& other) const -> std::strong_ordering = default;
    };
 
+   static_assert(sizeof(lex_item) == 16, "lex_item should fit in 16 bytes");
+
+   /**
+    * @brief The length of the longest lexeme a `munster::lex_item` can refer to
+    */
+   constexpr std::uint32_t max_lexeme_length = (1U << 24U) - 1; // NOLINT
+
+   /**
+    * @brief Access the lexeme of a `munster::lex_item` within the source it was lexed from
+    *
+    * @param [in] item The `munster::lex_item` to get the lexeme of
+    * @param [in] source The source `item` was lexed from
+    *
+    * @return A view into `source`. String literals are returned without their quotation marks
+    */
+   constexpr auto lexeme(const lex_item& item, std::string_view source) -> std::string_view
+   {
+      if (item.type == grammar::token_type::e_eof)
+      {
+         return "$";
+      }
+
+      const auto text = source.substr(item.offset, item.length);
+      if (item.type == grammar::token_type::e_str_lit)
+      {
+         return text.substr(1, std::size(text) - 2);
+      }
+
+      return text;
+   }
+
+   /**
+    * @brief Lexes a source one token at a time, as they are requested.
+    *
+    * Only the state needed to lex the next token is kept, the source itself is not owned by the
+    * stream and must outlive it. Copying a stream yields an independent stream starting at the
+    * same token.
+    */
+   class token_stream
+   {
+   public:
+      /**
+       * @brief Lex the next token of the source. Once the end of the source is reached, every call
+       * returns a `grammar::token_type::e_eof` item
+       */
+      auto next() -> lex_item;
+
+      /**
+       * @brief Access the source the tokens are lexed from
+       */
+      [[nodiscard]] auto source() const noexcept -> std::string_view;
+
+      friend auto make_token_stream(std::string_view source, util::logger_wrapper log)
+         -> monad::maybe<token_stream>;
+
+   private:
+      explicit token_stream(std::string_view source);
+
+      void lex_next_lexeme();
+
+   private:
+      std::string_view m_source;
+      std::string_view m_remaining;
+
+      std::uint32_t m_line{};
+      std::uint32_t m_column{};
+
+      // lexeme waiting to be returned, in multiple parts if longer than max_lexeme_length
+      grammar::token_type m_pending_type{};
+      std::size_t m_pending_offset{};
+      std::size_t m_pending_length{};
+      source_location m_pending_pos{};
+   };
+
+   /**
+    * @brief Create a `munster::token_stream` over a source
+    *
+    * @param [in] source The source to lex
+    * @param [in] log A logger used for status information
+    *
+    * @return The `munster::token_stream`, or nothing if the source is too large for its offsets to
+    * be stored in a `munster::lex_item`
+    */
+   auto make_token_stream(std::string_view source, util::logger_wrapper log = nullptr)
+      -> monad::maybe<token_stream>;
+
+   /**
+    * @brief The tokens of a lexed file along with the source they refer to
+    */
+   struct lex_result
+   {
+      source_buffer source;
+      std::vector<lex_item> items;
+   };
+
    /**
     * @brief Opens a file and lexes it
     *
     * @param [in] path The path to the file
     * @param [in] log A logger used for status information
     *
-    * @return The list of `fr::lex_item` from the file
+    * @return The list of `fr::lex_item` from the file along with the content of the file
     */
    auto lex_file(const std::filesystem::path& path, util::logger_wrapper log = nullptr)
-      -> monad::maybe<std::vector<lex_item>>;
+      -> monad::maybe<lex_result>;
 } // namespace munster
 
 /**
@@ -69,7 +170,12 @@ struct fmt::formatter<munster::lex_item>
    template <typename FormatContext>
    auto format(const munster::lex_item& tok, FormatContext& ctx)
    {
-      return fmt::format_to(ctx.out(), "[.type = {0}, .lexeme = {1}, .position = {2}]", tok.type,
-                            tok.lexeme, tok.pos);
+      // bit-fields cannot be bound to the references taken by fmt
+      const munster::grammar::token_type type = tok.type;
+      const std::uint32_t length = tok.length;
+
+      return fmt::format_to(ctx.out(),
+                            "[.type = {0}, .offset = {1}, .length = {2}, .position = {3}]", type,
+                            tok.offset, length, tok.pos);
    }
 };
@@ -44,7 +44,7 @@ TEST_SUITE("Lexer test suite")
 
          REQUIRE(maybe.has_value());
 
-         auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          CHECK(std::size(data) == 23);
 
@@ -61,7 +61,7 @@ TEST_SUITE("Lexer test suite")
 
          REQUIRE(maybe.has_value());
 
-         auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          CHECK(std::size(data) == 13);
          CHECK(data.at(0).type == munster::grammar::token_type::e_invalid_char);
@@ -98,7 +98,7 @@ TEST_SUITE("Lexer test suite")
 
          REQUIRE(maybe);
 
-         auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          CHECK(data.at(0).type == munster::grammar::token_type::e_integer_lit);
          CHECK(data.at(1).type == munster::grammar::token_type::e_integer_lit);
@@ -132,7 +132,7 @@ TEST_SUITE("Lexer test suite")
 
          REQUIRE(maybe);
 
-         auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          for (std::uint32_t index = 1; auto& tok : std::span(std::begin(data), std::end(data) - 1))
          {
@@ -146,7 +146,7 @@ TEST_SUITE("Lexer test suite")
 
          REQUIRE(maybe);
 
-         const auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          /*
          CHECK(data.at(0) == lex_item{munster::grammar::token_type::integer_lit, "0", 1});
@@ -195,7 +195,7 @@ TEST_SUITE("Lexer test suite")
 
          REQUIRE(maybe);
 
-         auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          for (auto& tok : std::span{std::begin(data), std::end(data) - 1})
          {
@@ -208,7 +208,7 @@ TEST_SUITE("Lexer test suite")
 
          REQUIRE(maybe);
 
-         auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          CHECK(std::size(data) == 4);
 
@@ -224,7 +224,7 @@ TEST_SUITE("Lexer test suite")
 
       REQUIRE(maybe);
 
-      const auto data = maybe.value();
+      const auto& data = maybe.value().items;
 
       /*
       CHECK(*(std::begin(data) + 0) ==
@@ -244,7 +244,7 @@ TEST_SUITE("Lexer test suite")
       {
          auto maybe = munster::lex_file("lexer/operators_valid.txt");
          REQUIRE(maybe);
-         const auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          /*
          CHECK(data.at(0) == lex_item{.type = munster::grammar::token_type::equal, .lexeme = "==",
@@ -279,7 +279,7 @@ TEST_SUITE("Lexer test suite")
       auto maybe = munster::lex_file("lexer/braces_valid.txt");
       REQUIRE(maybe);
 
-      const auto data = maybe.value();
+      const auto& data = maybe.value().items;
 
       /*
       CHECK(*(std::begin(data) + 0) ==
@@ -303,7 +303,7 @@ TEST_SUITE("Lexer test suite")
          auto maybe = munster::lex_file("lexer/comment_valid.txt");
          REQUIRE(maybe);
 
-         const auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          CHECK((std::begin(data) + 0)->type == munster::grammar::token_type::e_line_cmt);
          CHECK((std::begin(data) + 1)->type == munster::grammar::token_type::e_block_cmt);
@@ -316,7 +316,7 @@ TEST_SUITE("Lexer test suite")
          auto maybe = munster::lex_file("lexer/comment_invalid.txt");
          REQUIRE(maybe);
 
-         const auto data = maybe.value();
+         const auto& data = maybe.value().items;
 
          CHECK(std::begin(data)->type == munster::grammar::token_type::e_invalid_cmt);
       }
@@ -327,36 +327,115 @@ TEST_SUITE("Lexer test suite")
 
       REQUIRE(maybe);
 
-      const auto data = maybe.value();
+      const auto& data = maybe.value().items;
 
       CHECK(*(std::begin(data) + 0) ==
-            munster::lex_item{
-               .type = munster::grammar::token_type::e_invalid_char, .lexeme = "@", .pos = {1, 1}});
+            munster::lex_item{.type = munster::grammar::token_type::e_invalid_char,
+                              .length = 1,
+                              .offset = 0,
+                              .pos = {1, 1}});
       CHECK(*(std::begin(data) + 1) ==
-            munster::lex_item{
-               .type = munster::grammar::token_type::e_invalid_char, .lexeme = "#", .pos = {1, 3}});
+            munster::lex_item{.type = munster::grammar::token_type::e_invalid_char,
+                              .length = 1,
+                              .offset = 2,
+                              .pos = {1, 3}});
       CHECK(*(std::begin(data) + 2) ==
-            munster::lex_item{
-               .type = munster::grammar::token_type::e_invalid_char, .lexeme = "$", .pos = {1, 5}});
+            munster::lex_item{.type = munster::grammar::token_type::e_invalid_char,
+                              .length = 1,
+                              .offset = 4,
+                              .pos = {1, 5}});
       CHECK(*(std::begin(data) + 3) ==
-            munster::lex_item{
-               .type = munster::grammar::token_type::e_invalid_char, .lexeme = "'", .pos = {1, 7}});
+            munster::lex_item{.type = munster::grammar::token_type::e_invalid_char,
+                              .length = 1,
+                              .offset = 6,
+                              .pos = {1, 7}});
       CHECK(*(std::begin(data) + 4) ==
             munster::lex_item{.type = munster::grammar::token_type::e_invalid_char,
-                              .lexeme = "\\",
+                              .length = 1,
+                              .offset = 8,
                               .pos = {1, 9}});
       CHECK(*(std::begin(data) + 5) ==
             munster::lex_item{.type = munster::grammar::token_type::e_invalid_char,
-                              .lexeme = "~",
+                              .length = 1,
+                              .offset = 10,
                               .pos = {1, 11}});
+
+      const auto source = maybe.value().source.view();
+      CHECK(munster::lexeme(*(std::begin(data) + 0), source) == "@");
+      CHECK(munster::lexeme(*(std::begin(data) + 4), source) == "\\");
    }
    TEST_CASE("fmt::formatter - munster::lex_item")
    {
-      munster::lex_item tok{
-         .type = munster::grammar::token_type::e_integer_lit, .lexeme = "hello", .pos = {10, 10}};
+      munster::lex_item tok{.type = munster::grammar::token_type::e_integer_lit,
+                            .length = 5,
+                            .offset = 12,
+                            .pos = {10, 10}};
 
       CHECK(fmt::format("{}", tok) ==
-            fmt::format("[.type = {}, .lexeme = {}, .position = <line:{}, col:{}>]", tok.type,
-                        tok.lexeme, tok.pos.line, tok.pos.column));
+            fmt::format("[.type = {}, .offset = {}, .length = {}, .position = <line:{}, col:{}>]",
+                        munster::grammar::token_type::e_integer_lit, 12, 5, tok.pos.line,
+                        tok.pos.column));
+   }
+   TEST_CASE("lexeme")
+   {
+      using munster::grammar::token_type;
+
+      constexpr std::string_view source = "var x : string = \"hello\";";
+
+      const munster::lex_item keyword{.type = token_type::e_var, .length = 3, .offset = 0};
+      const munster::lex_item string{.type = token_type::e_str_lit, .length = 7, .offset = 17};
+      const munster::lex_item eof{.type = token_type::e_eof, .offset = 25};
+
+      CHECK(munster::lexeme(keyword, source) == "var");
+      CHECK(munster::lexeme(string, source) == "hello");
+      CHECK(munster::lexeme(eof, source) == "$");
+   }
+   TEST_CASE("token_stream")
+   {
+      using munster::grammar::token_type;
+
+      SUBCASE("on demand lexing")
+      {
+         constexpr std::string_view source = "// comment\nvar x : float;";
+
+         auto maybe = munster::make_token_stream(source);
+
+         REQUIRE(maybe);
+
+         auto stream = maybe.value();
+         auto copy = stream;
+
+         CHECK(stream.next().type == token_type::e_line_cmt);
+
+         const auto var = stream.next();
+
+         CHECK(var.type == token_type::e_var);
+         CHECK(var.pos.line == 2);
+         CHECK(munster::lexeme(var, source) == "var");
+
+         CHECK(stream.next().type == token_type::e_id);
+         CHECK(stream.next().type == token_type::e_colon);
+         CHECK(stream.next().type == token_type::e_float);
+         CHECK(stream.next().type == token_type::e_semi_colon);
+         CHECK(stream.next().type == token_type::e_eof);
+         CHECK(stream.next().type == token_type::e_eof);
+
+         CHECK(copy.next().type == token_type::e_line_cmt);
+      }
+      SUBCASE("same tokens as lex_file")
+      {
+         auto maybe = munster::lex_file("lexer/comment_valid.txt");
+
+         REQUIRE(maybe);
+
+         auto stream = munster::make_token_stream(maybe.value().source.view());
+
+         REQUIRE(stream);
+
+         for (const auto& item : maybe.value().items)
+         {
+            CHECK(stream->next() == item);
+         }
+      }
    }
 }
@@ -26,16 +26,17 @@
 #include <fmt/color.h>
 #include <fmt/core.h>
 #include <fmt/format.h>
+#include <fmt/ostream.h>
 #include <fmt/ranges.h>
 
 #include <range/v3/algorithm/find.hpp>
 #include <range/v3/algorithm/find_if.hpp>
-#include <range/v3/functional/not_fn.hpp>
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
 
 #include <iostream>
 
@@ -45,18 +46,11 @@ namespace munster
 
    auto construct_symbol_table() -> const grammar::production_table;
    auto is_comment(const lex_item& item) -> bool;
-   auto is_epsilon(const grammar::symbol& s) -> bool { return s == grammar::token_type::e_epsilon; }
-   auto pop(std::vector<grammar::symbol>& stack) -> grammar::symbol
-   {
-      auto temp = *(std::end(stack) - 1);
-      stack.pop_back();
-      return temp;
-   }
 
-   auto check_follow_sets(grammar::token_type type, const grammar::symbol& top) -> bool
+   auto check_follow_sets(grammar::token_type type, grammar::grammar_type head) -> bool
    {
-      const auto tail =
-         ranges::find(grammar::sets::follow, top, &grammar::production::start)->tail();
+      const auto& tail =
+         ranges::find(grammar::sets::follow, head, &grammar::production::start)->tail();
 
       return ranges::find(tail, type) != std::end(tail);
    }
@@ -66,127 +60,158 @@ namespace munster
       return ranges::find(tail, type) != std::end(tail);
    }
 
-   auto parse_impl(std::span<const lex_item> items, util::logger_wrapper log) -> parse_result
+   /**
+    * @brief Pull the next token from the stream, skipping over the comments
+    */
+   auto next_token(token_stream& tokens) -> lex_item
+   {
+      auto item = tokens.next();
+      while (is_comment(item))
+      {
+         item = tokens.next();
+      }
+
+      return item;
+   }
+
+   /**
+    * @brief Format the content of the parse stack, from top to bottom, without the actions
+    */
+   auto format_stack(std::span<const grammar::packed_symbol> stack) -> std::string
    {
-      static const auto table = grammar::construct_production_table();
+      const auto action_filter = [](grammar::packed_symbol s) {
+         return !grammar::is_action(s);
+      };
+
+      return fmt::format("{}", stack | vi::reverse | vi::filter(action_filter) |
+                                  vi::transform(grammar::unpack) | ranges::to_vector);
+   }
 
+   auto parse_impl(token_stream& tokens, parse_options options, util::logger_wrapper log)
+      -> parse_result
+   {
       std::vector<parse_error> errors;
+      auto arena = std::make_unique<ast::arena>();
       std::vector<munster::ast::node_ptr> nodes;
-      std::vector<grammar::symbol> stack;
-      stack.push_back(grammar::symbol::stop());
-      stack.push_back(grammar::symbol::start());
+      std::vector<grammar::packed_symbol> stack;
+      stack.push_back(grammar::packed_stop);
+      stack.push_back(grammar::pack(grammar::symbol::start()));
 
-      std::string derivation;
-      std::string parsed_tokens;
-      std::string final_derivations;
+      std::vector<derivation_event> derivation;
 
-      const auto action_filter = [](grammar::symbol& s) {
-         return !grammar::is_action(s);
-      };
+      const auto source = tokens.source();
 
-      auto item_it = std::begin(items);
-      while (stack.back() != grammar::symbol::stop())
+      // only the token being parsed & the last one accepted are kept around
+      lex_item previous{};
+      lex_item current = next_token(tokens);
+      while (!grammar::is_stop(stack.back()))
       {
-         derivation =
-            fmt::format("{}", stack | vi::reverse | vi::filter(action_filter) | ranges::to_vector);
+         const auto top_symbol = stack.back();
 
-         const auto& top_symbol = stack.back();
+         auto event = derivation_event{};
 
          if (grammar::is_terminal(top_symbol))
          {
-            if (!grammar::is_eof(item_it->type) && top_symbol == item_it->type)
+            if (!grammar::is_eof(current.type) && top_symbol == grammar::pack(current.type))
             {
-               log.info("Parsed token: {}", *item_it);
+               log.info("Parsed token: {}", current);
 
-               parsed_tokens += fmt::format("{} ", item_it->lexeme);
+               event = derivation_event{.token = current, .step = derivation_step::e_match};
 
                stack.pop_back();
-               ++item_it;
+               previous = current;
+               current = next_token(tokens);
             }
             else
             {
-               if (grammar::is_eof(item_it->type))
+               if (grammar::is_eof(current.type))
                {
-                  log.info("symbol {} popped from stack", top_symbol);
+                  log.info("symbol {} popped from stack", grammar::unpack(top_symbol));
 
+                  event.step = derivation_step::e_pop;
                   stack.pop_back();
                }
                else
                {
                   log.warning("SCANNING...");
 
-                  const auto type = get<grammar::symbol_type::terminal>(top_symbol);
+                  const auto type = grammar::get_token_type(top_symbol);
                   errors.push_back(parse_error{.type = parse_error_type::e_syntax_error,
-                                               .pos = item_it->pos,
+                                               .pos = current.pos,
                                                .lexeme = fmt::format("{}", type),
                                                .line = {}});
 
-                  while (!grammar::is_eof(item_it->type) && item_it->type != top_symbol)
+                  while (!grammar::is_eof(current.type) &&
+                         grammar::pack(current.type) != top_symbol)
                   {
-                     log.warning("\t{} : {}", top_symbol, *item_it);
+                     log.warning("\t{} : {}", grammar::unpack(top_symbol), current);
 
-                     ++item_it;
+                     previous = current;
+                     current = next_token(tokens);
                   }
                }
             }
          }
          else if (grammar::is_non_terminal(top_symbol))
          {
-            const auto head = get<grammar::symbol_type::non_terminal>(top_symbol);
-            const auto& production = table.lookup({head, item_it->type});
-            if (production != grammar::production{})
+            const auto head = grammar::get_grammar_type(top_symbol);
+            const grammar::token_type type = current.type; // a bit-field can't bind to the key
+            if (const auto* p_production = grammar::lookup_precompiled({head, type}))
             {
-               const auto symbols = production.tail() | ranges::views::reverse | ranges::to_vector;
+               const auto symbols = grammar::stack_symbols(*p_production);
 
-               log.info("Applying derivation: {}", grammar::production{head, symbols});
+               log.info("Applying derivation: {} -> {}", head,
+                        symbols | vi::reverse | vi::transform(grammar::unpack) | ranges::to_vector);
 
-               stack.pop_back();
+               event = derivation_event{.p_production = p_production,
+                                        .step = derivation_step::e_derive};
 
-               for (auto& symbol : symbols | vi::filter(ranges::not_fn(is_epsilon)))
-               {
-                  stack.push_back(symbol);
-               }
+               stack.pop_back();
+               stack.insert(std::end(stack), std::begin(symbols), std::end(symbols));
             }
             else
             {
-               if (grammar::is_eof(item_it->type) || check_follow_sets(item_it->type, top_symbol))
+               if (grammar::is_eof(current.type) || check_follow_sets(current.type, head))
                {
-                  log.info("symbol {} popped from stack", top_symbol);
+                  log.info("symbol {} popped from stack", grammar::unpack(top_symbol));
+
+                  event.step = derivation_step::e_pop;
                   stack.pop_back();
                }
                else
                {
                   const auto& first_it =
-                     ranges::find(grammar::sets::first, top_symbol, &grammar::production::start);
+                     ranges::find(grammar::sets::first, head, &grammar::production::start);
                   const auto& follow_it =
-                     ranges::find(grammar::sets::follow, top_symbol, &grammar::production::start);
+                     ranges::find(grammar::sets::follow, head, &grammar::production::start);
 
-                  log.warning("SCANNING OF {}...", top_symbol);
+                  log.warning("SCANNING OF {}...", grammar::unpack(top_symbol));
 
-                  const auto type = get<grammar::symbol_type::non_terminal>(top_symbol);
                   errors.push_back(parse_error{.type = parse_error_type::e_syntax_error,
-                                               .pos = item_it->pos,
-                                               .lexeme = fmt::format("{}", type),
+                                               .pos = current.pos,
+                                               .lexeme = fmt::format("{}", head),
                                                .line = {}});
 
                   if (first_it->nullable())
                   {
-                     while (!grammar::is_eof(item_it->type) &&
-                            !contains(follow_it->tail(), item_it->type))
+                     while (!grammar::is_eof(current.type) &&
+                            !contains(follow_it->tail(), current.type))
                      {
-                        log.warning("\t{} : {}", top_symbol, *item_it);
+                        log.warning("\t{} : {}", grammar::unpack(top_symbol), current);
 
-                        ++item_it;
+                        previous = current;
+                        current = next_token(tokens);
                      }
                   }
                   else
                   {
-                     while (!grammar::is_eof(item_it->type) &&
-                            !contains(first_it->tail(), item_it->type))
+                     while (!grammar::is_eof(current.type) &&
+                            !contains(first_it->tail(), current.type))
                      {
-                        log.warning("\t{} : {}", top_symbol, *item_it);
+                        log.warning("\t{} : {}", grammar::unpack(top_symbol), current);
 
-                        ++item_it;
+                        previous = current;
+                        current = next_token(tokens);
                      }
                   }
                }
@@ -196,39 +221,69 @@ namespace munster
          {
             const auto type = grammar::get_action_type(top_symbol);
 
+            event.step = derivation_step::e_pop;
             stack.pop_back();
-            if (item_it != std::begin(items))
-            {
-               nodes.push_back(munster::ast::node_factory(type, *(item_it - 1), nodes));
-            }
-            else
-            {
-               nodes.push_back(munster::ast::node_factory(type, {}, nodes));
-            }
+            nodes.push_back(munster::ast::node_factory(type, previous, source, nodes, *arena));
          }
 
-         final_derivations += fmt::format("{}{}\n", parsed_tokens, derivation);
+         if (options.trace_derivations)
+         {
+            derivation.push_back(event);
+         }
       }
 
-      if (!grammar::is_eof(item_it->type) || !std::empty(errors))
+      if (!grammar::is_eof(current.type) || !std::empty(errors))
       {
          return {.value = parse_status::error,
+                 .arena = std::move(arena),
                  .ast = std::move(nodes.back()),
-                 .derivation = final_derivations,
+                 .derivation = std::move(derivation),
                  .errors = errors};
       }
 
       return {.value = parse_status::success,
+              .arena = std::move(arena),
               .ast = std::move(nodes.back()),
-              .derivation = final_derivations,
+              .derivation = std::move(derivation),
               .errors = std::nullopt};
    }
 
-   auto parse_items(std::span<const lex_item> items, util::logger_wrapper log) -> parse_result
+   auto parse_tokens(token_stream tokens, parse_options options, util::logger_wrapper log)
+      -> parse_result
    {
-      const auto cleaned = items | vi::filter(ranges::not_fn(is_comment)) | ranges::to_vector;
+      return parse_impl(tokens, options, log);
+   }
+
+   void write_derivations(std::ostream& os, std::span<const derivation_event> events,
+                          std::string_view source)
+   {
+      std::vector<grammar::packed_symbol> stack;
+      stack.push_back(grammar::packed_stop);
+      stack.push_back(grammar::pack(grammar::symbol::start()));
+
+      std::string parsed_tokens;
+      for (const auto& event : events)
+      {
+         const auto derivation = format_stack(stack);
 
-      return parse_impl(cleaned, log);
+         if (event.step == derivation_step::e_match)
+         {
+            parsed_tokens += fmt::format("{} ", lexeme(event.token, source));
+         }
+
+         if (event.step != derivation_step::e_none)
+         {
+            stack.pop_back();
+         }
+
+         if (event.step == derivation_step::e_derive)
+         {
+            const auto symbols = grammar::stack_symbols(*event.p_production);
+            stack.insert(std::end(stack), std::begin(symbols), std::end(symbols));
+         }
+
+         fmt::print(os, "{}{}\n", parsed_tokens, derivation);
+      }
    }
 
    auto is_comment(const lex_item& item) -> bool
@@ -21,12 +21,15 @@
 
 #include <toy_compiler/munster/ast/node.hpp>
 #include <toy_compiler/munster/ast/node_factory.hpp>
+#include <toy_compiler/munster/grammar/production_table.hpp>
 #include <toy_compiler/munster/lexer.hpp>
 #include <toy_compiler/munster/parse_error.hpp>
 #include <toy_compiler/util/logger.hpp>
 
 #include <monads/maybe.hpp>
 
+#include <iosfwd>
+#include <memory>
 #include <span>
 #include <unordered_map>
 
@@ -41,23 +44,67 @@ namespace munster
       error
    };
 
+   /**
+    * @brief The change made to the parse stack by a single step of the parser
+    */
+   enum struct derivation_step : std::uint8_t
+   {
+      e_none,
+      e_pop,
+      e_match,
+      e_derive
+   };
+
+   /**
+    * @brief A step of the parser, recorded when derivation tracing is enabled. The derivation is
+    * rendered from these only when it is written out, see `munster::write_derivations`
+    */
+   struct derivation_event
+   {
+      lex_item token{};                                             // NOLINT e_match only
+      const grammar::precompiled_production* p_production{nullptr}; // NOLINT e_derive only
+      derivation_step step{derivation_step::e_none};                // NOLINT
+   };
+
+   /**
+    * @brief Options used to tune the work done by the parser
+    */
+   struct parse_options
+   {
+      bool trace_derivations = false; // NOLINT
+   };
+
    /**
     * @brief
     */
    struct [[nodiscard]] parse_result
    {
       parse_status value = parse_status::success;
+      std::unique_ptr<ast::arena> arena = nullptr; // owns every node of the `ast`
       ast::node_ptr ast = nullptr;
-      std::string derivation;
+      std::vector<derivation_event> derivation;
       std::optional<std::vector<parse_error>> errors = {};
    };
 
    /**
-    * @brief Parse an array of `front::lex_item` into a usable AST and performs simple syntax error
-    * checking
+    * @brief Parse the tokens of a `munster::token_stream` into a usable AST and performs simple
+    * syntax error checking. Tokens are pulled from the stream as the parser needs them and comments
+    * are skipped over
+    *
+    * @param[in] tokens The stream of tokens to use for parsing
+    * @param[in] options Options used to tune the work done by the parser
+    */
+   auto parse_tokens(token_stream tokens, parse_options options = {},
+                     util::logger_wrapper log = nullptr) -> parse_result;
+
+   /**
+    * @brief Replay the `munster::derivation_event`s of a parse to write out its derivation, one
+    * line per step: the tokens matched so far followed by the content of the parse stack
     *
-    * @param[in] items The lexed items to use for parsing
+    * @param[in] os The stream to write to
+    * @param[in] events The events recorded by `munster::parse_tokens`
+    * @param[in] source The source the tokens were lexed from
     */
-   auto parse_items(std::span<const lex_item> items, util::logger_wrapper log = nullptr)
-      -> parse_result;
+   void write_derivations(std::ostream& os, std::span<const derivation_event> events,
+                          std::string_view source);
 } // namespace munster
@@ -19,9 +19,153 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 
+#include <toy_compiler/munster/grammar/production_table.hpp>
 #include <toy_compiler/munster/parser.hpp>
+#include <toy_compiler/munster/source_buffer.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/reverse.hpp>
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace munster;
+
+namespace
+{
+   namespace vi = ranges::views;
+
+   /**
+    * @brief Derive a valid source the way the parser did before derivations were recorded: on
+    * the unpacked grammar, formatting the parsed tokens & the parse stack on every step
+    */
+   auto previous_derivation(std::string_view source) -> std::string
+   {
+      const auto table = grammar::construct_production_table();
+
+      const auto action_filter = [](const grammar::symbol& s) {
+         return !grammar::is_action(s);
+      };
+      const auto epsilon_filter = [](const grammar::symbol& s) {
+         return s != grammar::token_type::e_epsilon;
+      };
+
+      auto tokens = make_token_stream(source);
+      REQUIRE(tokens);
+
+      const auto next_token = [&] {
+         auto item = tokens->next();
+         while (item.type == grammar::token_type::e_block_cmt ||
+                item.type == grammar::token_type::e_line_cmt)
+         {
+            item = tokens->next();
+         }
+
+         return item;
+      };
+
+      std::vector<grammar::symbol> stack;
+      stack.push_back(grammar::symbol::stop());
+      stack.push_back(grammar::symbol::start());
+
+      std::string parsed_tokens;
+      std::string final_derivations;
+
+      lex_item current = next_token();
+      while (!grammar::is_stop(stack.back()))
+      {
+         const auto derivation =
+            fmt::format("{}", stack | vi::reverse | vi::filter(action_filter) | ranges::to_vector);
+
+         const auto top_symbol = stack.back();
+         stack.pop_back();
+
+         if (grammar::is_terminal(top_symbol) && !grammar::is_eof(current.type))
+         {
+            REQUIRE(top_symbol == current.type);
+
+            parsed_tokens += fmt::format("{} ", lexeme(current, source));
+            current = next_token();
+         }
+         else if (grammar::is_non_terminal(top_symbol))
+         {
+            const grammar::token_type type = current.type;
+            const auto& production = table.lookup({grammar::get_grammar_type(top_symbol), type});
+            if (production != grammar::production{})
+            {
+               for (const auto& symbol :
+                    production.tail() | vi::reverse | vi::filter(epsilon_filter))
+               {
+                  stack.push_back(symbol);
+               }
+            }
+         }
+
+         final_derivations += fmt::format("{}{}\n", parsed_tokens, derivation);
+      }
+
+      return final_derivations;
+   }
+
+   auto split_lines(const std::string& text) -> std::vector<std::string>
+   {
+      std::vector<std::string> lines;
+
+      std::istringstream stream{text};
+      for (std::string line; std::getline(stream, line);)
+      {
+         lines.push_back(line);
+      }
+
+      return lines;
+   }
+} // namespace
 
 TEST_SUITE("Parser test suite")
 {
-   TEST_CASE("TEST") { REQUIRE(true); }
+   TEST_CASE("derivation")
+   {
+      const auto buffer = open_source_buffer("test_files/parser/polynomial.src");
+      REQUIRE(buffer);
+
+      const auto source = buffer->view();
+
+      SUBCASE("nothing is recorded unless traced")
+      {
+         const auto tokens = make_token_stream(source);
+         REQUIRE(tokens);
+
+         const auto result = parse_tokens(tokens.value());
+         REQUIRE(result.value == parse_status::success);
+         CHECK(std::empty(result.derivation));
+      }
+      SUBCASE("the recorded derivation is written as the parser used to format it")
+      {
+         const auto tokens = make_token_stream(source);
+         REQUIRE(tokens);
+
+         const auto result = parse_tokens(tokens.value(), parse_options{.trace_derivations = true});
+         REQUIRE(result.value == parse_status::success);
+
+         std::ostringstream written;
+         write_derivations(written, result.derivation, source);
+
+         const auto recorded = split_lines(written.str());
+         const auto expected = split_lines(previous_derivation(source));
+
+         REQUIRE_FALSE(std::empty(expected));
+         REQUIRE(std::size(recorded) == std::size(expected));
+         for (std::size_t i = 0; i < std::size(expected); ++i)
+         {
+            INFO("line ", i + 1);
+            CHECK(recorded[i] == expected[i]);
+         }
+      }
+   }
 }
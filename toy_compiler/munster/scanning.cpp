@@ -0,0 +1,379 @@
+/**
+ * @file scanning.cpp
+ * @brief Implement the functions defined at scanning.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/scanning.hpp>
+
+#include <toy_compiler/munster/utility.hpp>
+
+#include <bit>
+
+// SSE2 is part of the x86-64 baseline, AVX2 has to be detected at runtime
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#   define TOY_COMPILER_HAS_X86_SIMD 1
+#   include <immintrin.h>
+#   define TOY_COMPILER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace munster
+{
+   /////////////// BLOCK HELPERS //////////////////
+
+   // The SIMD implementations turn each block of data into bit masks (one bit per byte) and
+   // share the following functions to interpret those masks.
+
+   /**
+    * @brief Update a `munster::whitespace_scan` with a block of data
+    *
+    * @param [in] ws Mask of the whitespaces of the block
+    * @param [in] nl Mask of the newlines of the block
+    * @param [in] base Index of the first byte of the block
+    * @param [in] width The number of bytes in the block
+    * @param [in, out] scan The scan to update
+    * @param [in, out] line_start The index following the last newline found
+    *
+    * @return True if a non whitespace character was found in the block
+    */
+   constexpr auto consume_whitespace_block(std::uint32_t ws, std::uint32_t nl, std::size_t base,
+                                           std::size_t width, whitespace_scan& scan,
+                                           std::size_t& line_start) -> bool
+   {
+      const std::uint32_t full = width == 32 ? ~0U : (1U << width) - 1; // NOLINT
+      const std::uint32_t non_ws = ~ws & full;
+      const auto prefix = non_ws != 0 ? static_cast<std::size_t>(std::countr_zero(non_ws)) : width;
+      const std::uint32_t prefix_mask = prefix == 32 ? ~0U : (1U << prefix) - 1; // NOLINT
+      const std::uint32_t newlines = nl & prefix_mask;
+
+      scan.newlines += static_cast<std::uint32_t>(std::popcount(newlines));
+      if (newlines != 0)
+      {
+         line_start = base + static_cast<std::size_t>(std::bit_width(newlines));
+      }
+
+      scan.length = base + prefix;
+
+      return non_ws != 0;
+   }
+
+   /**
+    * @brief Update a `munster::block_comment_scan` with a block of data
+    *
+    * @param [in] end Mask of the "*\/" starting in the block
+    * @param [in] nl Mask of the newlines of the block
+    * @param [in] base Index of the first byte of the block
+    * @param [in, out] scan The scan to update
+    *
+    * @return True if the terminator was found in the block
+    */
+   constexpr auto consume_comment_block(std::uint32_t end, std::uint32_t nl, std::size_t base,
+                                        block_comment_scan& scan) -> bool
+   {
+      if (end == 0)
+      {
+         scan.newlines += static_cast<std::uint32_t>(std::popcount(nl));
+
+         return false;
+      }
+
+      const auto position = static_cast<std::uint32_t>(std::countr_zero(end));
+      const std::uint32_t before = (1U << position) - 1;
+
+      scan.newlines += static_cast<std::uint32_t>(std::popcount(nl & before));
+      scan.terminator = base + position;
+
+      return true;
+   }
+
+   /////////////// SCALAR //////////////////
+
+   auto scan_whitespaces_scalar(std::string_view data, std::size_t index, whitespace_scan scan,
+                                std::size_t line_start) -> whitespace_scan
+   {
+      for (; index < std::size(data) && is_whitespace(data[index]); ++index)
+      {
+         if (is_newline(data[index]))
+         {
+            ++scan.newlines;
+            line_start = index + 1;
+         }
+      }
+
+      scan.length = index;
+      scan.column = static_cast<std::uint32_t>(index - line_start);
+
+      return scan;
+   }
+   auto scan_block_comment_scalar(std::string_view data, std::size_t index,
+                                  block_comment_scan scan) -> block_comment_scan
+   {
+      for (; index < std::size(data); ++index)
+      {
+         if (data[index] == '*' && index + 1 < std::size(data) && data[index + 1] == '/')
+         {
+            scan.terminator = index;
+
+            return scan;
+         }
+
+         if (is_newline(data[index]))
+         {
+            ++scan.newlines;
+         }
+      }
+
+      return scan;
+   }
+   auto count_newlines_scalar(std::string_view data, std::size_t index, std::uint32_t count)
+      -> std::uint32_t
+   {
+      for (; index < std::size(data); ++index)
+      {
+         count += is_newline(data[index]) ? 1 : 0;
+      }
+
+      return count;
+   }
+
+#if defined(TOY_COMPILER_HAS_X86_SIMD)
+   /////////////// SSE2 //////////////////
+
+   constexpr std::size_t sse2_width = 16;
+
+   inline auto sse2_load(const char* p) -> __m128i
+   {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); // NOLINT
+   }
+   inline auto sse2_mask_eq(__m128i block, char c) -> std::uint32_t
+   {
+      return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(c))));
+   }
+   inline auto sse2_mask_whitespace(__m128i block) -> std::uint32_t
+   {
+      // '\t', '\n', '\v', '\f' & '\r' are the contiguous range [9, 13]
+      const auto shifted = _mm_sub_epi8(block, _mm_set1_epi8('\t'));
+      const auto in_range = _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(4)), shifted);
+
+      return static_cast<std::uint32_t>(_mm_movemask_epi8(in_range)) | sse2_mask_eq(block, ' ');
+   }
+
+   auto scan_whitespaces_sse2(std::string_view data) -> whitespace_scan
+   {
+      whitespace_scan scan{};
+      std::size_t line_start = 0;
+      std::size_t index = 0;
+
+      for (; index + sse2_width <= std::size(data); index += sse2_width)
+      {
+         const auto block = sse2_load(std::data(data) + index);
+         if (consume_whitespace_block(sse2_mask_whitespace(block), sse2_mask_eq(block, '\n'),
+                                      index, sse2_width, scan, line_start))
+         {
+            scan.column = static_cast<std::uint32_t>(scan.length - line_start);
+
+            return scan;
+         }
+      }
+
+      return scan_whitespaces_scalar(data, index, scan, line_start);
+   }
+   auto scan_block_comment_sse2(std::string_view data) -> block_comment_scan
+   {
+      block_comment_scan scan{};
+      std::size_t index = 0;
+
+      for (; index + sse2_width + 1 <= std::size(data); index += sse2_width)
+      {
+         const auto block = sse2_load(std::data(data) + index);
+         const auto next = sse2_load(std::data(data) + index + 1);
+         const auto end = sse2_mask_eq(block, '*') & sse2_mask_eq(next, '/');
+
+         if (consume_comment_block(end, sse2_mask_eq(block, '\n'), index, scan))
+         {
+            return scan;
+         }
+      }
+
+      return scan_block_comment_scalar(data, index, scan);
+   }
+   auto count_newlines_sse2(std::string_view data) -> std::uint32_t
+   {
+      std::uint32_t count = 0;
+      std::size_t index = 0;
+
+      for (; index + sse2_width <= std::size(data); index += sse2_width)
+      {
+         const auto block = sse2_load(std::data(data) + index);
+         count += static_cast<std::uint32_t>(std::popcount(sse2_mask_eq(block, '\n')));
+      }
+
+      return count_newlines_scalar(data, index, count);
+   }
+
+   /////////////// AVX2 //////////////////
+
+   constexpr std::size_t avx2_width = 32;
+
+   TOY_COMPILER_TARGET_AVX2 inline auto avx2_load(const char* p) -> __m256i
+   {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); // NOLINT
+   }
+   TOY_COMPILER_TARGET_AVX2 inline auto avx2_mask_eq(__m256i block, char c) -> std::uint32_t
+   {
+      return static_cast<std::uint32_t>(
+         _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(c))));
+   }
+   TOY_COMPILER_TARGET_AVX2 inline auto avx2_mask_whitespace(__m256i block) -> std::uint32_t
+   {
+      const auto shifted = _mm256_sub_epi8(block, _mm256_set1_epi8('\t'));
+      const auto in_range =
+         _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8(4)), shifted);
+
+      return static_cast<std::uint32_t>(_mm256_movemask_epi8(in_range)) |
+         avx2_mask_eq(block, ' ');
+   }
+
+   TOY_COMPILER_TARGET_AVX2 auto scan_whitespaces_avx2(std::string_view data) -> whitespace_scan
+   {
+      whitespace_scan scan{};
+      std::size_t line_start = 0;
+      std::size_t index = 0;
+
+      for (; index + avx2_width <= std::size(data); index += avx2_width)
+      {
+         const auto block = avx2_load(std::data(data) + index);
+         if (consume_whitespace_block(avx2_mask_whitespace(block), avx2_mask_eq(block, '\n'),
+                                      index, avx2_width, scan, line_start))
+         {
+            scan.column = static_cast<std::uint32_t>(scan.length - line_start);
+
+            return scan;
+         }
+      }
+
+      return scan_whitespaces_scalar(data, index, scan, line_start);
+   }
+   TOY_COMPILER_TARGET_AVX2 auto scan_block_comment_avx2(std::string_view data)
+      -> block_comment_scan
+   {
+      block_comment_scan scan{};
+      std::size_t index = 0;
+
+      for (; index + avx2_width + 1 <= std::size(data); index += avx2_width)
+      {
+         const auto block = avx2_load(std::data(data) + index);
+         const auto next = avx2_load(std::data(data) + index + 1);
+         const auto end = avx2_mask_eq(block, '*') & avx2_mask_eq(next, '/');
+
+         if (consume_comment_block(end, avx2_mask_eq(block, '\n'), index, scan))
+         {
+            return scan;
+         }
+      }
+
+      return scan_block_comment_scalar(data, index, scan);
+   }
+   TOY_COMPILER_TARGET_AVX2 auto count_newlines_avx2(std::string_view data) -> std::uint32_t
+   {
+      std::uint32_t count = 0;
+      std::size_t index = 0;
+
+      for (; index + avx2_width <= std::size(data); index += avx2_width)
+      {
+         const auto block = avx2_load(std::data(data) + index);
+         count += static_cast<std::uint32_t>(std::popcount(avx2_mask_eq(block, '\n')));
+      }
+
+      return count_newlines_scalar(data, index, count);
+   }
+#endif
+
+   /////////////// DISPATCH //////////////////
+
+   auto best_simd_level() -> simd_level
+   {
+#if defined(TOY_COMPILER_HAS_X86_SIMD)
+      static const simd_level level = [] {
+         __builtin_cpu_init();
+         if (__builtin_cpu_supports("avx2"))
+         {
+            return simd_level::e_avx2;
+         }
+
+         if (__builtin_cpu_supports("sse2"))
+         {
+            return simd_level::e_sse2;
+         }
+
+         return simd_level::e_scalar;
+      }();
+
+      return level;
+#else
+      return simd_level::e_scalar;
+#endif
+   }
+
+   auto scan_whitespaces(std::string_view data, simd_level level) -> whitespace_scan
+   {
+#if defined(TOY_COMPILER_HAS_X86_SIMD)
+      if (level == simd_level::e_avx2)
+      {
+         return scan_whitespaces_avx2(data);
+      }
+
+      if (level == simd_level::e_sse2)
+      {
+         return scan_whitespaces_sse2(data);
+      }
+#endif
+
+      return scan_whitespaces_scalar(data, 0, {}, 0);
+   }
+   auto scan_block_comment(std::string_view data, simd_level level) -> block_comment_scan
+   {
+#if defined(TOY_COMPILER_HAS_X86_SIMD)
+      if (level == simd_level::e_avx2)
+      {
+         return scan_block_comment_avx2(data);
+      }
+
+      if (level == simd_level::e_sse2)
+      {
+         return scan_block_comment_sse2(data);
+      }
+#endif
+
+      return scan_block_comment_scalar(data, 0, {});
+   }
+   auto count_newlines(std::string_view data, simd_level level) -> std::uint32_t
+   {
+#if defined(TOY_COMPILER_HAS_X86_SIMD)
+      if (level == simd_level::e_avx2)
+      {
+         return count_newlines_avx2(data);
+      }
+
+      if (level == simd_level::e_sse2)
+      {
+         return count_newlines_sse2(data);
+      }
+#endif
+
+      return count_newlines_scalar(data, 0, 0);
+   }
+} // namespace munster
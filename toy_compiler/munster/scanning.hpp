@@ -0,0 +1,78 @@
+/**
+ * @file scanning.hpp
+ * @brief Contains the vectorized scanning functions used to skip over parts of the source
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace munster
+{
+   /**
+    * @brief The instruction sets the scanning functions may use
+    */
+   enum struct simd_level : std::uint32_t
+   {
+      e_scalar,
+      e_sse2,
+      e_avx2
+   };
+
+   /**
+    * @brief The best `munster::simd_level` supported by the CPU running the program
+    */
+   auto best_simd_level() -> simd_level;
+
+   /**
+    * @brief Result of skipping over the whitespaces at the start of some data
+    */
+   struct whitespace_scan
+   {
+      std::size_t length{};      // NOLINT
+      std::uint32_t newlines{};  // NOLINT
+      std::uint32_t column{};    // NOLINT number of characters after the last newline
+   };
+
+   /**
+    * @brief Result of searching for the end of a block comment
+    */
+   struct block_comment_scan
+   {
+      std::size_t terminator{std::string_view::npos}; // NOLINT position of the "*/"
+      std::uint32_t newlines{};                       // NOLINT newlines before the terminator
+   };
+
+   /**
+    * @brief Find the first non whitespace character of `data` while counting the newlines
+    * skipped, in a single pass
+    */
+   auto scan_whitespaces(std::string_view data, simd_level level = best_simd_level())
+      -> whitespace_scan;
+   /**
+    * @brief Find the first "*\/" in `data` while counting the newlines before it, in a single
+    * pass
+    */
+   auto scan_block_comment(std::string_view data, simd_level level = best_simd_level())
+      -> block_comment_scan;
+   /**
+    * @brief Count the number of newline characters in `data`
+    */
+   auto count_newlines(std::string_view data, simd_level level = best_simd_level())
+      -> std::uint32_t;
+} // namespace munster
@@ -0,0 +1,157 @@
+/**
+ * @brief Runs tests on functions defined in scanning.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/scanning.hpp>
+
+#include <string>
+#include <vector>
+
+using munster::simd_level;
+
+/**
+ * @brief The levels to compare against the scalar implementation. Only the ones supported by the
+ * running CPU are tested
+ */
+auto supported_levels() -> std::vector<simd_level>
+{
+   std::vector<simd_level> levels{simd_level::e_scalar};
+   if (munster::best_simd_level() >= simd_level::e_sse2)
+   {
+      levels.push_back(simd_level::e_sse2);
+   }
+
+   if (munster::best_simd_level() >= simd_level::e_avx2)
+   {
+      levels.push_back(simd_level::e_avx2);
+   }
+
+   return levels;
+}
+
+TEST_SUITE("Scanning test suite")
+{
+   TEST_CASE("scan_whitespaces")
+   {
+      SUBCASE("no whitespaces")
+      {
+         for (const auto level : supported_levels())
+         {
+            const auto scan = munster::scan_whitespaces("func main", level);
+
+            CHECK(scan.length == 0);
+            CHECK(scan.newlines == 0);
+            CHECK(scan.column == 0);
+         }
+      }
+      SUBCASE("only whitespaces")
+      {
+         const std::string data = std::string(40, ' ') + "\n\t\n" + std::string(30, '\v');
+         for (const auto level : supported_levels())
+         {
+            const auto scan = munster::scan_whitespaces(data, level);
+
+            CHECK(scan.length == std::size(data));
+            CHECK(scan.newlines == 2);
+            CHECK(scan.column == 30);
+         }
+      }
+      SUBCASE("whitespaces crossing block boundaries")
+      {
+         for (std::size_t count = 0; count < 70; ++count) // NOLINT
+         {
+            std::string data;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+               data += i % 7 == 3 ? '\n' : " \f\r\t\v"[i % 5]; // NOLINT
+            }
+            data += "var x;\n   ";
+
+            const auto expected = munster::scan_whitespaces(data, simd_level::e_scalar);
+
+            CHECK(expected.length == count);
+            for (const auto level : supported_levels())
+            {
+               const auto scan = munster::scan_whitespaces(data, level);
+
+               CHECK(scan.length == expected.length);
+               CHECK(scan.newlines == expected.newlines);
+               CHECK(scan.column == expected.column);
+            }
+         }
+      }
+   }
+   TEST_CASE("scan_block_comment")
+   {
+      SUBCASE("terminated comment")
+      {
+         const std::string data = "a\ncomment\n" + std::string(50, '*') + " x\n*/ after\n";
+         for (const auto level : supported_levels())
+         {
+            const auto scan = munster::scan_block_comment(data, level);
+
+            CHECK(scan.terminator == data.find("*/"));
+            CHECK(scan.newlines == 3);
+         }
+      }
+      SUBCASE("unterminated comment")
+      {
+         const std::string data = std::string(64, '\n') + "*";
+         for (const auto level : supported_levels())
+         {
+            const auto scan = munster::scan_block_comment(data, level);
+
+            CHECK(scan.terminator == std::string_view::npos);
+            CHECK(scan.newlines == 64);
+         }
+      }
+      SUBCASE("terminator crossing block boundaries")
+      {
+         for (std::size_t position = 0; position < 70; ++position) // NOLINT
+         {
+            std::string data(position, '\n');
+            data += "*/\n\n";
+
+            for (const auto level : supported_levels())
+            {
+               const auto scan = munster::scan_block_comment(data, level);
+
+               CHECK(scan.terminator == position);
+               CHECK(scan.newlines == position);
+            }
+         }
+      }
+   }
+   TEST_CASE("count_newlines")
+   {
+      std::string data;
+      for (std::size_t i = 0; i < 100; ++i) // NOLINT
+      {
+         data += i % 3 == 0 ? '\n' : 'x';
+      }
+
+      for (const auto level : supported_levels())
+      {
+         CHECK(munster::count_newlines(data, level) == 34);
+         CHECK(munster::count_newlines(std::string_view{data}.substr(5), level) == 32);
+         CHECK(munster::count_newlines("", level) == 0);
+      }
+   }
+}
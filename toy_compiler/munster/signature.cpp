@@ -0,0 +1,130 @@
+/**
+ * @file signature.cpp
+ * @brief Implement the functions defined at signature.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/signature.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+
+namespace munster
+{
+   auto operator==(const signature& lhs, const signature& rhs) -> bool
+   {
+      return lhs.name == rhs.name && lhs.return_type == rhs.return_type &&
+         std::ranges::equal(lhs.params, rhs.params);
+   }
+
+   auto signature_hash::operator()(const signature& value) const noexcept -> std::size_t
+   {
+      const auto combine = [](std::size_t seed, string_id id) {
+         const auto value = static_cast<std::size_t>(id);
+         return seed ^ (value + 0x9e3779b9U + (seed << 6U) + (seed >> 2U)); // NOLINT
+      };
+
+      auto seed = combine(std::size(value.params), value.name);
+      seed = combine(seed, value.return_type);
+      for (const auto param : value.params)
+      {
+         seed = combine(seed, param);
+      }
+
+      return seed;
+   }
+
+   signature_table::signature_table()
+   {
+      [[maybe_unused]] const auto empty = intern(signature{});
+      assert(empty == signature_id{}); // NOLINT
+   }
+
+   auto signature_table::global() -> signature_table&
+   {
+      static signature_table table;
+      return table;
+   }
+
+   auto signature_table::intern(const signature& value) -> signature_id
+   {
+      {
+         std::shared_lock lock{m_mutex};
+         if (const auto it = m_ids.find(value); it != std::end(m_ids))
+         {
+            return it->second;
+         }
+      }
+
+      std::unique_lock lock{m_mutex};
+
+      // another thread may have stored the signature while the lock was released
+      if (const auto it = m_ids.find(value); it != std::end(m_ids))
+      {
+         return it->second;
+      }
+
+      const auto count = std::size(value.params);
+
+      auto* p_params = static_cast<string_id*>(
+         m_resource.allocate(std::max(count, std::size_t{1}) * sizeof(string_id),
+                             alignof(string_id)));
+      std::ranges::copy(value.params, p_params);
+
+      const auto stored = signature{.name = value.name,
+                                    .return_type = value.return_type,
+                                    .params = std::span<const string_id>{p_params, count}};
+      const auto id = static_cast<signature_id>(std::size(m_signatures));
+
+      m_signatures.push_back(stored);
+      m_ids.try_emplace(stored, id);
+
+      return id;
+   }
+
+   auto signature_table::find(const signature& value) const -> monad::maybe<signature_id>
+   {
+      std::shared_lock lock{m_mutex};
+      if (const auto it = m_ids.find(value); it != std::end(m_ids))
+      {
+         return it->second;
+      }
+
+      return monad::none;
+   }
+
+   auto signature_table::get(signature_id id) const -> signature
+   {
+      std::shared_lock lock{m_mutex};
+
+      const auto index = static_cast<std::size_t>(id);
+      assert(index < std::size(m_signatures)); // NOLINT
+
+      return m_signatures[index];
+   }
+
+   auto signature_table::size() const -> std::size_t
+   {
+      std::shared_lock lock{m_mutex};
+      return std::size(m_signatures);
+   }
+
+   auto interned_signature(signature_id id) -> signature
+   {
+      return signature_table::global().get(id);
+   }
+} // namespace munster
@@ -0,0 +1,154 @@
+/**
+ * @file signature.hpp
+ * @brief Contains the structured signatures of functions and the table giving them ids
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <toy_compiler/munster/string_interner.hpp>
+#include <toy_compiler/util/flat_hash_map.hpp>
+
+#include <monads/maybe.hpp>
+
+#include <range/v3/view/transform.hpp>
+
+#include <fmt/core.h>
+#include <fmt/ranges.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace munster
+{
+   /**
+    * @brief The signature of a function, as ids of the global `munster::string_interner`
+    */
+   struct signature
+   {
+      string_id name{};
+      string_id return_type{};
+      std::span<const string_id> params{};
+
+      friend auto operator==(const signature& lhs, const signature& rhs) -> bool;
+   };
+
+   struct signature_hash
+   {
+      auto operator()(const signature& value) const noexcept -> std::size_t;
+   };
+
+   /**
+    * @brief The id of a signature stored in a `munster::signature_table`. The default id is the
+    * signature without name, return type nor parameters, it stands for "not a function"
+    */
+   enum struct signature_id : std::uint32_t
+   {
+   };
+
+   /**
+    * @brief Stores a single copy of every function signature given to it and hands out a
+    * `munster::signature_id` for each, so overloads can be told apart by comparing two integers.
+    *
+    * All member functions may be called from several threads at once
+    */
+   class signature_table
+   {
+   public:
+      signature_table();
+      signature_table(const signature_table&) = delete;
+      signature_table(signature_table&&) = delete;
+      ~signature_table() = default;
+
+      auto operator=(const signature_table&) -> signature_table& = delete;
+      auto operator=(signature_table&&) -> signature_table& = delete;
+
+      /**
+       * @brief The signature table shared by every part of the compiler
+       */
+      static auto global() -> signature_table&;
+
+      /**
+       * @brief Get the id of `value`, storing a copy of its parameters if it was never seen before
+       */
+      auto intern(const signature& value) -> signature_id;
+      /**
+       * @brief Get the id of `value` without storing it. Gives back nothing if `value` was never
+       * interned
+       */
+      [[nodiscard]] auto find(const signature& value) const -> monad::maybe<signature_id>;
+      /**
+       * @brief The signature of an id handed out by this table. Its parameters stay valid for the
+       * lifetime of the table
+       */
+      [[nodiscard]] auto get(signature_id id) const -> signature;
+
+      [[nodiscard]] auto size() const -> std::size_t;
+
+   private:
+      mutable std::shared_mutex m_mutex;
+
+      std::pmr::monotonic_buffer_resource m_resource;
+      std::vector<signature> m_signatures;
+      util::flat_hash_map<signature, signature_id, signature_hash> m_ids;
+   };
+
+   /**
+    * @brief Intern the signature `name 'return_type (params...)'` in the global
+    * `munster::signature_table`, interning each of its names in the global
+    * `munster::string_interner`
+    */
+   template <typename Range>
+   auto intern_signature(std::string_view name, std::string_view return_type,
+                         const Range& params) -> signature_id
+   {
+      std::vector<string_id> param_ids;
+      for (const auto& param : params)
+      {
+         param_ids.push_back(intern(param));
+      }
+
+      return signature_table::global().intern(
+         {.name = intern(name), .return_type = intern(return_type), .params = param_ids});
+   }
+   /**
+    * @brief The signature of an id handed out by the global `munster::signature_table`
+    */
+   auto interned_signature(signature_id id) -> signature;
+} // namespace munster
+
+template <>
+struct fmt::formatter<munster::signature>
+{
+   template <typename ParseContex>
+   constexpr auto parse(ParseContex& ctx)
+   {
+      return ctx.begin();
+   }
+
+   template <typename FormatContext>
+   auto format(const munster::signature& value, FormatContext& ctx)
+   {
+      const auto params = value.params | ranges::views::transform(munster::interned_view);
+
+      return fmt::format_to(ctx.out(), "{} '{} ({})'", value.name, value.return_type,
+                            fmt::join(params, ", "));
+   }
+};
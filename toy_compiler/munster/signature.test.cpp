@@ -0,0 +1,101 @@
+/**
+ * @brief Runs tests on functions defined in signature.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/signature.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+using namespace munster;
+
+TEST_SUITE("Signature test suite")
+{
+   TEST_CASE("empty signature")
+   {
+      signature_table table;
+
+      CHECK(table.size() == 1);
+      CHECK(table.intern(signature{}) == signature_id{});
+   }
+   TEST_CASE("intern")
+   {
+      signature_table table;
+
+      const std::array params{intern("integer"), intern("float")};
+      const std::array swapped{intern("float"), intern("integer")};
+
+      const signature value{.name = intern("f"), .return_type = intern("void"), .params = params};
+
+      const auto id = table.intern(value);
+      CHECK(id != signature_id{});
+      CHECK(table.intern(value) == id);
+
+      // the parameters are compared, not where they are stored
+      const std::vector copy(std::begin(params), std::end(params));
+      CHECK(table.intern({.name = value.name, .return_type = value.return_type, .params = copy}) ==
+            id);
+
+      CHECK(table.intern({.name = value.name, .return_type = value.return_type,
+                          .params = swapped}) != id);
+      CHECK(table.intern({.name = value.name, .return_type = intern("integer"),
+                          .params = params}) != id);
+      CHECK(table.intern({.name = intern("g"), .return_type = value.return_type,
+                          .params = params}) != id);
+      CHECK(table.size() == 5);
+   }
+   TEST_CASE("find & get")
+   {
+      signature_table table;
+
+      std::vector params{intern("integer[]")};
+      const signature value{
+         .name = intern("sum"), .return_type = intern("integer"), .params = params};
+
+      CHECK_FALSE(table.find(value));
+
+      const auto id = table.intern(value);
+      REQUIRE(table.find(value));
+      CHECK(table.find(value).value() == id);
+
+      // the table keeps its own copy of the parameters
+      params[0] = intern("float");
+
+      const auto stored = table.get(id);
+      CHECK(stored.name == intern("sum"));
+      CHECK(stored.return_type == intern("integer"));
+      REQUIRE(std::size(stored.params) == 1);
+      CHECK(stored.params[0] == intern("integer[]"));
+   }
+   TEST_CASE("intern_signature")
+   {
+      const std::vector<std::string> params{"integer", "float[2]"};
+
+      const auto id = intern_signature("area", "float", params);
+      CHECK(intern_signature("area", "float", params) == id);
+      CHECK(fmt::format("{}", interned_signature(id)) == "area 'float (integer, float[2])'");
+      CHECK(fmt::format("{}", interned_signature(intern_signature("main", "void",
+                                                                  std::vector<std::string>{}))) ==
+            "main 'void ()'");
+   }
+}
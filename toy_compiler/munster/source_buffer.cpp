@@ -0,0 +1,169 @@
+/**
+ * @file source_buffer.cpp
+ * @brief Implement the functions defined at source_buffer.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/source_buffer.hpp>
+
+#include <toy_compiler/munster/utility.hpp>
+
+#include <array>
+#include <cerrno>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   define TOY_COMPILER_HAS_MMAP 1
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#else
+#   include <fstream>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace munster
+{
+   /**
+    * @brief Size of the chunks used when a file cannot be mapped to memory
+    */
+   constexpr std::size_t read_chunk_size = 4_kb;
+
+   source_buffer::source_buffer(source_buffer&& other) noexcept :
+      mp_mapping{std::exchange(other.mp_mapping, nullptr)},
+      m_mapping_size{std::exchange(other.m_mapping_size, 0)}, m_owned{std::move(other.m_owned)}
+   {}
+   source_buffer::~source_buffer() { release(); }
+
+   auto source_buffer::operator=(source_buffer&& rhs) noexcept -> source_buffer&
+   {
+      if (this != &rhs)
+      {
+         release();
+
+         mp_mapping = std::exchange(rhs.mp_mapping, nullptr);
+         m_mapping_size = std::exchange(rhs.m_mapping_size, 0);
+         m_owned = std::move(rhs.m_owned);
+      }
+
+      return *this;
+   }
+
+   auto source_buffer::view() const noexcept -> std::string_view
+   {
+      if (mp_mapping)
+      {
+         return {mp_mapping, m_mapping_size};
+      }
+
+      return m_owned;
+   }
+   auto source_buffer::size() const noexcept -> std::size_t { return std::size(view()); }
+   auto source_buffer::is_mapped() const noexcept -> bool { return mp_mapping != nullptr; }
+
+   void source_buffer::release() noexcept
+   {
+#if defined(TOY_COMPILER_HAS_MMAP)
+      if (mp_mapping)
+      {
+         // NOLINTNEXTLINE
+         ::munmap(const_cast<char*>(mp_mapping), m_mapping_size);
+      }
+#endif
+
+      mp_mapping = nullptr;
+      m_mapping_size = 0;
+   }
+
+#if defined(TOY_COMPILER_HAS_MMAP)
+   auto open_source_buffer(const fs::path& path) -> monad::maybe<source_buffer>
+   {
+      const int fd = ::open(path.c_str(), O_RDONLY); // NOLINT
+      if (fd == -1)
+      {
+         return monad::none;
+      }
+
+      source_buffer buffer;
+
+      struct stat info
+      {};
+      if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
+      {
+         const auto size = static_cast<std::size_t>(info.st_size);
+         if (void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0); data != MAP_FAILED)
+         {
+            ::madvise(data, size, MADV_SEQUENTIAL);
+            ::close(fd);
+
+            buffer.mp_mapping = static_cast<const char*>(data);
+            buffer.m_mapping_size = size;
+
+            return buffer;
+         }
+      }
+
+      // pipes, character devices & files that failed to map are read one chunk at a time
+      std::array<char, read_chunk_size> chunk{};
+      while (true)
+      {
+         const auto count = ::read(fd, std::data(chunk), std::size(chunk));
+         if (count == 0)
+         {
+            break;
+         }
+
+         if (count == -1)
+         {
+            if (errno == EINTR)
+            {
+               continue;
+            }
+
+            ::close(fd);
+            return monad::none;
+         }
+
+         buffer.m_owned.append(std::data(chunk), static_cast<std::size_t>(count));
+      }
+
+      ::close(fd);
+
+      return buffer;
+   }
+#else
+   auto open_source_buffer(const fs::path& path) -> monad::maybe<source_buffer>
+   {
+      std::ifstream file{path, std::ios::in | std::ios::binary};
+      if (!file.is_open())
+      {
+         return monad::none;
+      }
+
+      source_buffer buffer;
+
+      std::array<char, read_chunk_size> chunk{};
+      while (file.read(std::data(chunk), std::size(chunk)) || file.gcount() > 0)
+      {
+         buffer.m_owned.append(std::data(chunk), static_cast<std::size_t>(file.gcount()));
+      }
+
+      return buffer;
+   }
+#endif
+} // namespace munster
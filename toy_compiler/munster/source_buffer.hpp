@@ -0,0 +1,83 @@
+/**
+ * @file source_buffer.hpp
+ * @brief Contains the read-only buffer used to hold the content of a source file
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <monads/maybe.hpp>
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace munster
+{
+   /**
+    * @brief A read-only view over the content of a source file.
+    *
+    * Regular files are memory mapped so that the lexer may run directly over the pages of the
+    * file without copying them. Anything that cannot be mapped (pipes, character devices such as
+    * stdin, empty files) is read in fixed size chunks into an owned buffer instead.
+    */
+   class source_buffer
+   {
+   public:
+      source_buffer() = default;
+      source_buffer(const source_buffer&) = delete;
+      source_buffer(source_buffer&& other) noexcept;
+      ~source_buffer();
+
+      auto operator=(const source_buffer&) -> source_buffer& = delete;
+      auto operator=(source_buffer&& rhs) noexcept -> source_buffer&;
+
+      /**
+       * @brief Access the content of the buffer
+       */
+      [[nodiscard]] auto view() const noexcept -> std::string_view;
+      /**
+       * @brief The number of bytes held by the buffer
+       */
+      [[nodiscard]] auto size() const noexcept -> std::size_t;
+      /**
+       * @brief Check if the content of the buffer is a memory mapping of the file
+       */
+      [[nodiscard]] auto is_mapped() const noexcept -> bool;
+
+      friend auto open_source_buffer(const std::filesystem::path& path)
+         -> monad::maybe<source_buffer>;
+
+   private:
+      void release() noexcept;
+
+   private:
+      const char* mp_mapping{nullptr};
+      std::size_t m_mapping_size{0};
+
+      std::string m_owned{};
+   };
+
+   /**
+    * @brief Open a file and make its content available through a `munster::source_buffer`
+    *
+    * @param [in] path The path to the file
+    *
+    * @return The `munster::source_buffer` holding the content of the file, or nothing if the file
+    * could not be opened or read
+    */
+   auto open_source_buffer(const std::filesystem::path& path) -> monad::maybe<source_buffer>;
+} // namespace munster
@@ -0,0 +1,64 @@
+/**
+ * @brief Runs tests on functions defined in source_buffer.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/source_buffer.hpp>
+
+#include <fstream>
+
+TEST_SUITE("Source buffer test suite")
+{
+   TEST_CASE("non-existant file")
+   {
+      auto maybe = munster::open_source_buffer("lexer/file_that_doesn't_exist.txt");
+
+      REQUIRE(!maybe);
+   }
+   TEST_CASE("regular file")
+   {
+      {
+         std::ofstream file{"source_buffer_regular.txt"};
+         file << "func main() -> void\n{\n}\n";
+      }
+
+      auto maybe = munster::open_source_buffer("source_buffer_regular.txt");
+
+      REQUIRE(maybe.has_value());
+
+      auto buffer = std::move(maybe.value());
+
+      CHECK(buffer.is_mapped());
+      CHECK(buffer.size() == 24);
+      CHECK(buffer.view() == "func main() -> void\n{\n}\n");
+   }
+   TEST_CASE("empty file")
+   {
+      {
+         std::ofstream file{"source_buffer_empty.txt"};
+      }
+
+      auto maybe = munster::open_source_buffer("source_buffer_empty.txt");
+
+      REQUIRE(maybe.has_value());
+
+      CHECK(!maybe.value().is_mapped());
+      CHECK(std::empty(maybe.value().view()));
+   }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file string_interner.cpp
+ * @brief Implement the functions defined at string_interner.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/string_interner.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+
+namespace munster
+{
+   string_interner::string_interner()
+   {
+      [[maybe_unused]] const auto empty = intern("");
+      assert(empty == string_id{}); // NOLINT
+   }
+
+   auto string_interner::global() -> string_interner&
+   {
+      static string_interner interner;
+      return interner;
+   }
+
+   auto string_interner::intern(std::string_view value) -> string_id
+   {
+      {
+         std::shared_lock lock{m_mutex};
+         if (const auto it = m_ids.find(value); it != std::end(m_ids))
+         {
+            return it->second;
+         }
+      }
+
+      std::unique_lock lock{m_mutex};
+
+      // another thread may have stored the string while the lock was released
+      if (const auto it = m_ids.find(value); it != std::end(m_ids))
+      {
+         return it->second;
+      }
+
+      const auto length = std::size(value);
+
+      auto* p_data = static_cast<char*>(m_resource.allocate(std::max(length, std::size_t{1}), 1));
+      std::memcpy(p_data, std::data(value), length);
+
+      const auto stored = std::string_view{p_data, length};
+      const auto id = static_cast<string_id>(std::size(m_strings));
+
+      m_strings.push_back(stored);
+      m_ids.try_emplace(stored, id);
+
+      return id;
+   }
+
+   auto string_interner::find(std::string_view value) const -> monad::maybe<string_id>
+   {
+      std::shared_lock lock{m_mutex};
+      if (const auto it = m_ids.find(value); it != std::end(m_ids))
+      {
+         return it->second;
+      }
+
+      return monad::none;
+   }
+
+   auto string_interner::view(string_id id) const -> std::string_view
+   {
+      std::shared_lock lock{m_mutex};
+
+      const auto index = static_cast<std::size_t>(id);
+      assert(index < std::size(m_strings)); // NOLINT
+
+      return m_strings[index];
+   }
+
+   auto string_interner::size() const -> std::size_t
+   {
+      std::shared_lock lock{m_mutex};
+      return std::size(m_strings);
+   }
+
+   auto intern(std::string_view value) -> string_id
+   {
+      return string_interner::global().intern(value);
+   }
+   auto interned_view(string_id id) -> std::string_view
+   {
+      return string_interner::global().view(id);
+   }
+} // namespace munster
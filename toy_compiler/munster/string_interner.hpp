@@ -0,0 +1,110 @@
+/**
+ * @file string_interner.hpp
+ * @brief Contains the table mapping the names used by the compiler to small integer ids
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <toy_compiler/util/flat_hash_map.hpp>
+
+#include <monads/maybe.hpp>
+
+#include <fmt/core.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+namespace munster
+{
+   /**
+    * @brief The id of a string stored in a `munster::string_interner`. Two ids from the same
+    * interner are equal if and only if their strings are. The default id is the empty string
+    */
+   enum struct string_id : std::uint32_t
+   {
+   };
+
+   /**
+    * @brief Stores a single copy of every string given to it and hands out a `munster::string_id`
+    * for each. Identifiers, type names and function signatures are interned while the AST is
+    * built, so the passes that come after can compare and hash them as integers.
+    *
+    * Strings are never removed, the views handed out stay valid for the lifetime of the interner.
+    * All member functions may be called from several threads at once
+    */
+   class string_interner
+   {
+   public:
+      string_interner();
+      string_interner(const string_interner&) = delete;
+      string_interner(string_interner&&) = delete;
+      ~string_interner() = default;
+
+      auto operator=(const string_interner&) -> string_interner& = delete;
+      auto operator=(string_interner&&) -> string_interner& = delete;
+
+      /**
+       * @brief The interner shared by every part of the compiler
+       */
+      static auto global() -> string_interner&;
+
+      /**
+       * @brief Get the id of `value`, storing a copy of it if it was never seen before
+       */
+      auto intern(std::string_view value) -> string_id;
+      /**
+       * @brief Get the id of `value` without storing it. Gives back nothing if `value` was
+       * never interned
+       */
+      [[nodiscard]] auto find(std::string_view value) const -> monad::maybe<string_id>;
+      /**
+       * @brief The string of an id handed out by this interner
+       */
+      [[nodiscard]] auto view(string_id id) const -> std::string_view;
+
+      [[nodiscard]] auto size() const -> std::size_t;
+
+   private:
+      mutable std::shared_mutex m_mutex;
+
+      std::pmr::monotonic_buffer_resource m_resource;
+      std::vector<std::string_view> m_strings;
+      util::flat_hash_map<std::string_view, string_id> m_ids;
+   };
+
+   /**
+    * @brief Intern `value` in the global `munster::string_interner`
+    */
+   auto intern(std::string_view value) -> string_id;
+   /**
+    * @brief The string of an id handed out by the global `munster::string_interner`
+    */
+   auto interned_view(string_id id) -> std::string_view;
+} // namespace munster
+
+template <>
+struct fmt::formatter<munster::string_id> : fmt::formatter<std::string_view>
+{
+   template <typename FormatContext>
+   auto format(munster::string_id id, FormatContext& ctx)
+   {
+      return fmt::formatter<std::string_view>::format(munster::interned_view(id), ctx);
+   }
+};
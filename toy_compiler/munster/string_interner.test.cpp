@@ -0,0 +1,115 @@
+/**
+ * @brief Runs tests on functions defined in string_interner.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/string_interner.hpp>
+
+#include <fmt/format.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace munster;
+
+TEST_SUITE("String interner test suite")
+{
+   TEST_CASE("empty string")
+   {
+      string_interner interner;
+
+      CHECK(interner.size() == 1);
+      CHECK(interner.intern("") == string_id{});
+      CHECK(interner.view(string_id{}).empty());
+   }
+   TEST_CASE("intern")
+   {
+      string_interner interner;
+
+      const auto a = interner.intern("a");
+      const auto b = interner.intern("b");
+
+      CHECK(a != b);
+      CHECK(interner.intern(std::string{"a"}) == a);
+      CHECK(interner.view(a) == "a");
+      CHECK(interner.view(b) == "b");
+      CHECK(interner.size() == 3);
+   }
+   TEST_CASE("find")
+   {
+      string_interner interner;
+
+      const auto id = interner.intern("main");
+
+      REQUIRE(interner.find("main"));
+      CHECK(interner.find("main").value() == id);
+      CHECK_FALSE(interner.find("other"));
+      CHECK(interner.size() == 2);
+   }
+   TEST_CASE("views stay valid")
+   {
+      string_interner interner;
+
+      const auto first = interner.view(interner.intern("first"));
+      for (int i = 0; i < 4096; ++i)
+      {
+         interner.intern(fmt::format("name_{}", i));
+      }
+
+      CHECK(first == "first");
+      CHECK(interner.view(interner.intern("name_42")) == "name_42");
+   }
+   TEST_CASE("concurrent intern")
+   {
+      constexpr int thread_count = 4;
+      constexpr int name_count = 1024;
+
+      string_interner interner;
+
+      std::vector<std::vector<string_id>> ids(thread_count);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < thread_count; ++t)
+      {
+         threads.emplace_back([&, t] {
+            for (int i = 0; i < name_count; ++i)
+            {
+               ids[t].push_back(interner.intern(fmt::format("name_{}", i)));
+            }
+         });
+      }
+
+      for (auto& thread : threads)
+      {
+         thread.join();
+      }
+
+      CHECK(interner.size() == name_count + 1);
+      for (int t = 1; t < thread_count; ++t)
+      {
+         CHECK(ids[t] == ids[0]);
+      }
+   }
+   TEST_CASE("format")
+   {
+      const auto id = intern("formatted");
+
+      CHECK(fmt::format("'{}'", id) == "'formatted'");
+   }
+}
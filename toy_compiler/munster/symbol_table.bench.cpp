@@ -0,0 +1,174 @@
+/**
+ * @file symbol_table.bench.cpp
+ * @brief Measures the rate at which a symbol_table, defined in symbol_table.hpp, looks up the
+ * symbols of a scope
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <toy_compiler/munster/symbol_table.hpp>
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace munster;
+
+namespace
+{
+   constexpr std::size_t lookup_count = 1U << 20U;
+   constexpr std::size_t round_count = 8;
+
+   // from the handful of variables of a function to the members of a large program's global scope
+   constexpr std::array symbol_counts{std::size_t{8}, std::size_t{64}, std::size_t{512},
+                                      std::size_t{4096}};
+
+   auto make_symbol(const std::string& name) -> symbol
+   {
+      return symbol{{.name = name, .kind = symbol_type::e_variable, .type = "integer"}};
+   }
+
+   /**
+    * @brief The best time, in nanoseconds, taken by `fn` to look up `lookup_count` names picked
+    * pseudo randomly among `count` of them
+    */
+   template <typename Fn>
+   auto measure(std::size_t count, Fn fn) -> std::int64_t
+   {
+      auto best = std::numeric_limits<std::int64_t>::max();
+      for (std::size_t round = 0; round < round_count; ++round)
+      {
+         std::uint32_t state = 0x9e3779b9U; // NOLINT
+         std::size_t found = 0;
+
+         const auto start = std::chrono::steady_clock::now();
+         for (std::size_t i = 0; i < lookup_count; ++i)
+         {
+            state ^= state << 13U; // NOLINT
+            state ^= state >> 17U; // NOLINT
+            state ^= state << 5U;  // NOLINT
+
+            found += fn(state % count) ? 1 : 0;
+         }
+         const auto end = std::chrono::steady_clock::now();
+
+         if (found != lookup_count)
+         {
+            fmt::print("missing symbols in a table of {}\n", count);
+         }
+
+         best = std::min<std::int64_t>(
+            best, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+      }
+
+      return best;
+   }
+
+   /**
+    * @brief The best time, in nanoseconds, taken to fill enough tables of `count` symbols with
+    * `fill` to insert `lookup_count` symbols
+    */
+   template <typename Fill>
+   auto measure_fill(std::size_t count, Fill fill) -> std::int64_t
+   {
+      auto best = std::numeric_limits<std::int64_t>::max();
+      for (std::size_t round = 0; round < round_count; ++round)
+      {
+         const auto start = std::chrono::steady_clock::now();
+         for (std::size_t i = 0; i < lookup_count / count; ++i)
+         {
+            fill();
+         }
+         const auto end = std::chrono::steady_clock::now();
+
+         best = std::min<std::int64_t>(
+            best, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+      }
+
+      return best;
+   }
+} // namespace
+
+auto main() -> int
+{
+   const auto rate = [](std::int64_t ns) {
+      return static_cast<double>(lookup_count) * 1e3 / static_cast<double>(ns); // NOLINT
+   };
+
+   fmt::print("{} lookups & insertions, best of {} rounds, in Mops/s\n", lookup_count,
+              round_count);
+   fmt::print("{:>8} {:>16} {:>16} {:>16} {:>16} {:>16}\n", "symbols", "find string keys",
+              "find id keys", "symbol_table", "insert id keys", "symbol_table");
+
+   for (const auto count : symbol_counts)
+   {
+      std::vector<std::string> names;
+      std::vector<string_id> ids;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         names.push_back(fmt::format("var_{}", i));
+         ids.push_back(intern(names.back()));
+      }
+
+      // the layout of the symbol tables before names were interned
+      std::unordered_map<std::string, symbol> by_string;
+      std::unordered_map<string_id, symbol> by_id;
+      symbol_table table{"bench", symbol_table_type::e_func};
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         by_string.emplace(names[i], make_symbol(names[i]));
+         by_id.emplace(ids[i], make_symbol(names[i]));
+         table.insert(ids[i], make_symbol(names[i]));
+      }
+
+      const auto string_time = measure(count, [&](std::size_t i) {
+         return by_string.find(names[i]) != std::end(by_string);
+      });
+      const auto id_time = measure(count, [&](std::size_t i) {
+         return by_id.find(ids[i]) != std::end(by_id);
+      });
+      const auto table_time = measure(count, [&](std::size_t i) {
+         return static_cast<bool>(table.lookup(ids[i]));
+      });
+
+      const auto id_fill_time = measure_fill(count, [&] {
+         std::unordered_map<string_id, symbol> map;
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            map.emplace(ids[i], make_symbol(names[i]));
+         }
+      });
+      const auto table_fill_time = measure_fill(count, [&] {
+         symbol_table filled{"bench", symbol_table_type::e_func};
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            filled.insert(ids[i], make_symbol(names[i]));
+         }
+      });
+
+      fmt::print("{:>8} {:>16.2f} {:>16.2f} {:>16.2f} {:>16.2f} {:>16.2f}\n", count,
+                 rate(string_time), rate(id_time), rate(table_time), rate(id_fill_time),
+                 rate(table_fill_time));
+   }
+
+   return 0;
+}
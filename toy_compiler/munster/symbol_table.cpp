@@ -2,6 +2,9 @@
 
 #include <toy_compiler/munster/symbol_table.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <mutex>
 #include <utility>
 
 #include <range/v3/algorithm/find.hpp>
@@ -29,14 +32,17 @@ namespace munster
    void symbol::update_size(std::int64_t size) { m_size = size; }
    void symbol::set_table(std::unique_ptr<symbol_table> table) { m_link = std::move(table); }
 
-   symbol_table::lookup_kv_result::lookup_kv_result(const std::string* p_key, symbol* p_val) :
+   symbol_table::lookup_kv_result::lookup_kv_result(const symbol_key* p_key, symbol* p_val) :
       m_key{p_key},
       m_value{p_val}
    {}
 
    symbol_table::lookup_kv_result::operator bool() const { return m_key != nullptr; }
 
-   auto symbol_table::lookup_kv_result::key() const -> std::string_view { return *m_key; }
+   auto symbol_table::lookup_kv_result::key() const -> std::string_view
+   {
+      return interned_view(m_key->name());
+   }
    auto symbol_table::lookup_kv_result::val() const -> symbol& { return *m_value; }
 
    symbol_table::insert_kv_result::insert_kv_result(iterator value, bool insertion) :
@@ -46,23 +52,26 @@ namespace munster
 
    auto symbol_table::insert_kv_result::is_inserted() const noexcept -> bool { return m_insertion; }
 
-   auto symbol_table::insert_kv_result::key() const -> std::string_view { return m_value->first; }
+   auto symbol_table::insert_kv_result::key() const -> std::string_view
+   {
+      return interned_view(m_value->first.name());
+   }
    auto symbol_table::insert_kv_result::val() const -> symbol& { return m_value->second; }
 
-   symbol_table::remove_kv_result::remove_kv_result(std::string&& key, symbol&& val) :
-      m_key{std::move(key)},
+   symbol_table::remove_kv_result::remove_kv_result(symbol_key key, symbol&& val) :
+      m_key{key},
       m_val{std::move(val)}
    {}
 
    symbol_table::remove_kv_result::operator bool() const { return m_key.has_value(); }
 
-   auto symbol_table::remove_kv_result::key() const -> std::string_view { return m_key.value(); }
-   auto symbol_table::remove_kv_result::val() const -> const symbol& { return m_val.value(); }
-
-   auto symbol_table::remove_kv_result::take_key() -> std::string
+   auto symbol_table::remove_kv_result::key() const -> std::string_view
    {
-      return std::move(m_key.value());
+      return interned_view(m_key->name());
    }
+   auto symbol_table::remove_kv_result::val() const -> const symbol& { return m_val.value(); }
+
+   auto symbol_table::remove_kv_result::take_key() -> symbol_key { return m_key.value(); }
    auto symbol_table::remove_kv_result::take_val() -> symbol { return std::move(m_val.value()); }
 
    symbol_table::symbol_table(std::string name, symbol_table_type kind) :
@@ -72,18 +81,15 @@ namespace munster
 
    auto symbol_table::name() const noexcept -> std::string_view { return m_name; }
    auto symbol_table::kind() const noexcept -> symbol_table_type { return m_kind; }
-   auto symbol_table::symbols() const -> const std::unordered_map<std::string, symbol>&
-   {
-      return m_symbols;
-   }
-   auto symbol_table::symbols() -> std::unordered_map<std::string, symbol>& { return m_symbols; }
+   auto symbol_table::symbols() const -> const container& { return m_symbols; }
+   auto symbol_table::symbols() -> container& { return m_symbols; }
 
-   auto symbol_table::lookup(const std::string& name) -> lookup_kv_result
+   auto symbol_table::lookup(symbol_key key) -> lookup_kv_result
    {
-      auto it = m_symbols.find(name);
+      auto it = m_symbols.find(key);
       if (it != std::end(m_symbols))
       {
-         const std::string* p_key = &(it->first);
+         const symbol_key* p_key = &(it->first);
          symbol* p_val = &(it->second);
 
          return lookup_kv_result{p_key, p_val};
@@ -93,27 +99,201 @@ namespace munster
          return lookup_kv_result{nullptr, nullptr};
       }
    }
-   auto symbol_table::insert(const std::string& name, symbol&& value) -> insert_kv_result
+   auto symbol_table::insert(symbol_key key, symbol&& value) -> insert_kv_result
    {
-      auto [it, insertion] = m_symbols.insert({name, std::move(value)});
+      if (key.is_function() && key.name() == string_id{})
+      {
+         key = symbol_key{interned_signature(key.overload()).name, key.overload()};
+      }
+
+      auto [it, insertion] = m_symbols.try_emplace(key, std::move(value));
+      if (insertion && key.is_function())
+      {
+         m_overloads.try_emplace(key.name()).first->second.push_back(key.overload());
+      }
+      else if (insertion)
+      {
+         forget(key.name());
+      }
 
       return {it, insertion};
    }
-   auto symbol_table::remove(const std::string& name) -> remove_kv_result
+   auto symbol_table::remove(symbol_key key) -> remove_kv_result
    {
-      auto it = m_symbols.find(name);
+      auto it = m_symbols.find(key);
 
       if (it != std::end(m_symbols))
       {
-         auto key = it->first;
+         const auto stored = it->first;
          auto val = std::move(it->second);
 
          m_symbols.erase(it);
 
-         return {std::move(key), std::move(val)};
+         if (stored.is_function())
+         {
+            auto& overloads = m_overloads.find(stored.name())->second;
+            overloads.erase(std::ranges::find(overloads, stored.overload()));
+         }
+         else
+         {
+            forget(stored.name());
+         }
+
+         return {stored, std::move(val)};
       }
 
       return {};
    }
 
+   auto symbol_table::insert(std::string_view name, symbol&& value) -> insert_kv_result
+   {
+      return insert(intern(name), std::move(value));
+   }
+   auto symbol_table::lookup(std::string_view name) -> lookup_kv_result
+   {
+      if (const auto key = string_interner::global().find(name))
+      {
+         return lookup(key.value());
+      }
+
+      return lookup_kv_result{nullptr, nullptr};
+   }
+   auto symbol_table::remove(std::string_view name) -> remove_kv_result
+   {
+      if (const auto key = string_interner::global().find(name))
+      {
+         return remove(key.value());
+      }
+
+      return {};
+   }
+
+   auto symbol_table::overloads(string_id name) const -> std::span<const signature_id>
+   {
+      if (const auto it = m_overloads.find(name); it != std::end(m_overloads))
+      {
+         return it->second;
+      }
+
+      return {};
+   }
+
+   void symbol_table::set_parent(symbol_table* p_parent)
+   {
+      assert(p_parent != this); // NOLINT
+
+      if (mp_parent)
+      {
+         std::erase(mp_parent->m_dependents, this);
+      }
+
+      mp_parent = p_parent;
+      forget_all();
+
+      if (mp_parent)
+      {
+         mp_parent->m_dependents.push_back(this);
+      }
+   }
+   auto symbol_table::add_base(symbol_table* p_base) -> bool
+   {
+      assert(p_base != nullptr); // NOLINT
+
+      if (p_base == this || p_base->inherits_from(this))
+      {
+         return false;
+      }
+
+      m_bases.push_back(p_base);
+      forget_all();
+
+      p_base->m_dependents.push_back(this);
+
+      return true;
+   }
+
+   auto symbol_table::parent() const noexcept -> symbol_table* { return mp_parent; }
+   auto symbol_table::bases() const noexcept -> std::span<symbol_table* const> { return m_bases; }
+
+   auto symbol_table::resolve(string_id name) -> symbol*
+   {
+      if (const auto it = m_symbols.find(symbol_key{name}); it != std::end(m_symbols))
+      {
+         return &it->second;
+      }
+
+      {
+         std::shared_lock lock{m_resolved_mutex};
+         if (const auto it = m_resolved.find(name); it != std::end(m_resolved))
+         {
+            return it->second;
+         }
+      }
+
+      symbol* p_symbol = nullptr;
+      for (symbol_table* p_base : m_bases)
+      {
+         if ((p_symbol = p_base->resolve(name)))
+         {
+            break;
+         }
+      }
+
+      if (!p_symbol && mp_parent)
+      {
+         p_symbol = mp_parent->resolve(name);
+      }
+
+      // misses aren't remembered, the names looked up in vain are mostly typos
+      if (p_symbol)
+      {
+         std::unique_lock lock{m_resolved_mutex};
+         m_resolved.try_emplace(name, p_symbol);
+      }
+
+      return p_symbol;
+   }
+   auto symbol_table::resolve(std::string_view name) -> symbol*
+   {
+      if (const auto key = string_interner::global().find(name))
+      {
+         return resolve(key.value());
+      }
+
+      return nullptr;
+   }
+
+   auto symbol_table::inherits_from(const symbol_table* p_table) const -> bool
+   {
+      return std::ranges::any_of(m_bases, [=](const symbol_table* p_base) {
+         return p_base == p_table || p_base->inherits_from(p_table);
+      });
+   }
+
+   void symbol_table::forget(string_id name)
+   {
+      {
+         std::unique_lock lock{m_resolved_mutex};
+         m_resolved.erase(name);
+      }
+
+      // misses aren't remembered, so a dependent that doesn't remember the name may still have
+      // dependents that found it past this table, every one of them has to forget it
+      for (symbol_table* p_dependent : m_dependents)
+      {
+         p_dependent->forget(name);
+      }
+   }
+   void symbol_table::forget_all()
+   {
+      {
+         std::unique_lock lock{m_resolved_mutex};
+         m_resolved.clear();
+      }
+
+      for (symbol_table* p_dependent : m_dependents)
+      {
+         p_dependent->forget_all();
+      }
+   }
 } // namespace munster
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <toy_compiler/munster/source_location.hpp>
+#include <toy_compiler/munster/signature.hpp>
+#include <toy_compiler/munster/string_interner.hpp>
+#include <toy_compiler/util/flat_hash_map.hpp>
 
 #include <magic_enum.hpp>
 
@@ -13,9 +16,10 @@
 
 #include <memory>
 #include <optional>
+#include <shared_mutex>
 #include <span>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace munster
 {
@@ -86,12 +90,56 @@ namespace munster
       source_location m_location;
    };
 
+   /**
+    * @brief The key of a symbol in a `munster::symbol_table`. Functions are told apart by their
+    * signature, so the overloads of a name each get their own symbol, every other symbol by its
+    * name
+    */
+   class symbol_key
+   {
+   public:
+      symbol_key() = default;
+      symbol_key(string_id name) : m_name{name} {}                // NOLINT
+      symbol_key(signature_id overload) : m_overload{overload} {} // NOLINT
+      symbol_key(string_id name, signature_id overload) : m_name{name}, m_overload{overload} {}
+
+      [[nodiscard]] auto name() const noexcept -> string_id { return m_name; }
+      [[nodiscard]] auto overload() const noexcept -> signature_id { return m_overload; }
+      [[nodiscard]] auto is_function() const noexcept -> bool
+      {
+         return m_overload != signature_id{};
+      }
+
+      /**
+       * @brief The signature holds the name of a function, so two function keys are equal if
+       * their signatures are, whether the name was given or not
+       */
+      friend auto operator==(symbol_key lhs, symbol_key rhs) noexcept -> bool
+      {
+         return lhs.m_overload == rhs.m_overload &&
+            (lhs.is_function() || lhs.m_name == rhs.m_name);
+      }
+
+   private:
+      string_id m_name{};
+      signature_id m_overload{};
+   };
+
+   struct symbol_key_hash
+   {
+      auto operator()(symbol_key key) const noexcept -> std::size_t
+      {
+         return key.is_function() ? std::hash<signature_id>{}(key.overload())
+                                  : std::hash<string_id>{}(key.name());
+      }
+   };
+
    class symbol_table
    {
-      using container = std::unordered_map<std::string, symbol>;
+      using container = util::flat_hash_map<symbol_key, symbol, symbol_key_hash>;
 
    public:
-      using key_type = std::string;
+      using key_type = symbol_key;
       using mapped_type = symbol;
       using iterator = container::iterator;
       using const_iterator = container::const_iterator;
@@ -114,7 +162,7 @@ namespace munster
       class lookup_kv_result
       {
       public:
-         lookup_kv_result(const std::string* p_key, symbol* p_val);
+         lookup_kv_result(const symbol_key* p_key, symbol* p_val);
 
          explicit operator bool() const;
 
@@ -122,7 +170,7 @@ namespace munster
          auto val() const -> symbol&;          // NOLINT
 
       private:
-         const std::string* m_key;
+         const symbol_key* m_key;
          symbol* m_value;
       };
 
@@ -130,18 +178,18 @@ namespace munster
       {
       public:
          remove_kv_result() = default;
-         remove_kv_result(std::string&& key, symbol&& val);
+         remove_kv_result(symbol_key key, symbol&& val);
 
          explicit operator bool() const;
 
          auto key() const -> std::string_view; // NOLINT
          auto val() const -> const symbol&;    // NOLINT
 
-         auto take_key() -> std::string;
+         auto take_key() -> symbol_key;
          auto take_val() -> symbol;
 
       private:
-         std::optional<std::string> m_key = std::nullopt;
+         std::optional<symbol_key> m_key = std::nullopt;
          std::optional<symbol> m_val = std::nullopt;
       };
 
@@ -151,18 +199,81 @@ namespace munster
 
       auto name() const noexcept -> std::string_view;  // NOLINT
       auto kind() const noexcept -> symbol_table_type; // NOLINT
-      auto symbols() const -> const std::unordered_map<std::string, symbol>&;
-      auto symbols() -> std::unordered_map<std::string, symbol>&;
+      auto symbols() const -> const container&;
+      auto symbols() -> container&;
+
+      /**
+       * @brief Insert `value` under `key`, adding it to the overload set of its name if it is a
+       * function
+       */
+      auto insert(symbol_key key, symbol&& value) -> insert_kv_result;
+      auto lookup(symbol_key key) -> lookup_kv_result;
+      auto remove(symbol_key key) -> remove_kv_result;
+
+      /**
+       * @brief Insert `value` under the interned `name`
+       */
+      auto insert(std::string_view name, symbol&& value) -> insert_kv_result;
+      /**
+       * @brief Lookup `name` without interning it, a name that was never interned has no symbol
+       */
+      auto lookup(std::string_view name) -> lookup_kv_result;
+      auto remove(std::string_view name) -> remove_kv_result;
+
+      /**
+       * @brief The signatures of the functions named `name` in the table, in insertion order
+       */
+      [[nodiscard]] auto overloads(string_id name) const -> std::span<const signature_id>;
+
+      /**
+       * @brief Make `p_parent` the scope enclosing the table, names the table doesn't hold are
+       * then resolved in it. The table doesn't own its parent
+       */
+      void set_parent(symbol_table* p_parent);
+      /**
+       * @brief Add `p_base` to the classes the table inherits from. Gives back false, without
+       * adding it, if the table would end up inheriting from itself
+       */
+      auto add_base(symbol_table* p_base) -> bool;
+
+      [[nodiscard]] auto parent() const noexcept -> symbol_table*;
+      [[nodiscard]] auto bases() const noexcept -> std::span<symbol_table* const>;
+
+      /**
+       * @brief Find the symbol `name` refers to from the table: in the table itself, then in the
+       * classes it inherits from, in the order they were added, then in its parent. Symbols found
+       * through the chain are remembered until a table of the chain inserts or removes `name`.
+       *
+       * Names may be resolved from several threads at once, as long as no table of the chain is
+       * modified meanwhile
+       */
+      auto resolve(string_id name) -> symbol*;
+      auto resolve(std::string_view name) -> symbol*;
 
-      auto insert(const std::string& name, symbol&& value) -> insert_kv_result;
-      auto lookup(const std::string& name) -> lookup_kv_result;
-      auto remove(const std::string& name) -> remove_kv_result;
+   private:
+      [[nodiscard]] auto inherits_from(const symbol_table* p_table) const -> bool;
+      /**
+       * @brief Drop what the table and the tables resolving names through it remember of `name`
+       */
+      void forget(string_id name);
+      /**
+       * @brief Drop everything the table and the tables resolving names through it remember
+       */
+      void forget_all();
 
    private:
       std::string m_name = "default";
       symbol_table_type m_kind{symbol_table_type::e_undefined};
 
-      std::unordered_map<std::string, symbol> m_symbols;
+      container m_symbols;
+      util::flat_hash_map<string_id, std::vector<signature_id>> m_overloads;
+
+      symbol_table* mp_parent{nullptr};
+      std::vector<symbol_table*> m_bases;
+      std::vector<symbol_table*> m_dependents;
+
+      mutable std::shared_mutex m_resolved_mutex;
+      util::flat_hash_map<string_id, symbol*> m_resolved;
    };
 } // namespace munster
 
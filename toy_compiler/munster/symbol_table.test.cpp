@@ -0,0 +1,270 @@
+/**
+ * @brief Runs tests on functions defined in symbol_table.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/symbol_table.hpp>
+#include <toy_compiler/util/parallel_for.hpp>
+
+#include <fmt/core.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace munster;
+
+namespace
+{
+   auto make_symbol(std::string name, symbol_type kind) -> symbol
+   {
+      return symbol{{.name = std::move(name), .kind = kind}};
+   }
+} // namespace
+
+TEST_SUITE("Symbol table test suite")
+{
+   TEST_CASE("variables")
+   {
+      symbol_table table{"func", symbol_table_type::e_func};
+
+      REQUIRE(table.insert("x", make_symbol("x", symbol_type::e_variable)).is_inserted());
+      CHECK_FALSE(table.insert("x", make_symbol("x", symbol_type::e_variable)).is_inserted());
+
+      const auto result = table.lookup(intern("x"));
+      REQUIRE(result);
+      CHECK(result.key() == "x");
+      CHECK(result.val().name() == "x");
+
+      CHECK_FALSE(table.lookup("never_interned_name"));
+
+      auto removed = table.remove("x");
+      REQUIRE(removed);
+      CHECK(removed.take_val().name() == "x");
+      CHECK_FALSE(table.lookup("x"));
+   }
+   TEST_CASE("overloads")
+   {
+      symbol_table table{"class", symbol_table_type::e_class};
+
+      const auto first = intern_signature("area", "float", std::vector<std::string>{});
+      const auto second = intern_signature("area", "float", std::vector<std::string>{"integer"});
+      const auto other = intern_signature("perimeter", "float", std::vector<std::string>{});
+
+      REQUIRE(table.insert(first, make_symbol("area", symbol_type::e_member_function))
+                 .is_inserted());
+      REQUIRE(table.insert(second, make_symbol("area", symbol_type::e_member_function))
+                 .is_inserted());
+      REQUIRE(table.insert(other, make_symbol("perimeter", symbol_type::e_member_function))
+                 .is_inserted());
+      CHECK_FALSE(
+         table.insert(first, make_symbol("area", symbol_type::e_member_function)).is_inserted());
+
+      const auto overloads = table.overloads(intern("area"));
+      REQUIRE(std::size(overloads) == 2);
+      CHECK(overloads[0] == first);
+      CHECK(overloads[1] == second);
+
+      REQUIRE(table.lookup(second));
+      CHECK(table.lookup(second).key() == "area");
+      CHECK(table.lookup(symbol_key{intern("area"), second}));
+
+      // functions are only found through their signature
+      CHECK_FALSE(table.lookup("area"));
+
+      REQUIRE(table.remove(first));
+      CHECK_FALSE(table.lookup(first));
+      REQUIRE(std::size(table.overloads(intern("area"))) == 1);
+      CHECK(table.overloads(intern("area"))[0] == second);
+
+      CHECK(std::empty(table.overloads(intern("volume"))));
+   }
+   TEST_CASE("scope chain")
+   {
+      symbol_table class_table{"shape", symbol_table_type::e_class};
+      symbol_table func_table{"shape::area", symbol_table_type::e_func};
+      func_table.set_parent(&class_table);
+
+      REQUIRE(func_table.parent() == &class_table);
+
+      class_table.insert("width", make_symbol("width", symbol_type::e_member_variable));
+      class_table.insert("x", make_symbol("x", symbol_type::e_member_variable));
+      func_table.insert("x", make_symbol("x", symbol_type::e_variable));
+
+      REQUIRE(func_table.resolve("width"));
+      CHECK(func_table.resolve("width")->kind() == symbol_type::e_member_variable);
+      CHECK(func_table.resolve("x")->kind() == symbol_type::e_variable);
+      CHECK(class_table.resolve("x")->kind() == symbol_type::e_member_variable);
+
+      CHECK_FALSE(func_table.resolve("height"));
+      CHECK_FALSE(func_table.resolve("never_interned_name"));
+   }
+   TEST_CASE("inheritance")
+   {
+      symbol_table shape{"shape", symbol_table_type::e_class};
+      symbol_table named{"named", symbol_table_type::e_class};
+      symbol_table square{"square", symbol_table_type::e_class};
+      symbol_table func_table{"square::area", symbol_table_type::e_func};
+
+      REQUIRE(square.add_base(&shape));
+      REQUIRE(square.add_base(&named));
+      func_table.set_parent(&square);
+
+      REQUIRE(std::size(square.bases()) == 2);
+      CHECK(square.bases()[0] == &shape);
+
+      CHECK_FALSE(square.add_base(&square));
+      CHECK_FALSE(shape.add_base(&square));
+      CHECK(std::size(shape.bases()) == 0);
+
+      shape.insert("id", make_symbol("id", symbol_type::e_member_variable));
+      named.insert("id", make_symbol("id", symbol_type::e_member_variable));
+      named.insert("name", make_symbol("name", symbol_type::e_member_variable));
+
+      // bases are searched in the order they were added
+      CHECK(func_table.resolve("id") == shape.resolve("id"));
+      CHECK(func_table.resolve("name") == named.resolve("name"));
+   }
+   TEST_CASE("resolved names are forgotten when the chain changes")
+   {
+      symbol_table shape{"shape", symbol_table_type::e_class};
+      symbol_table square{"square", symbol_table_type::e_class};
+      symbol_table func_table{"square::area", symbol_table_type::e_func};
+
+      REQUIRE(square.add_base(&shape));
+      func_table.set_parent(&square);
+
+      shape.insert("width", make_symbol("width", symbol_type::e_member_variable));
+      REQUIRE(func_table.resolve("width") == shape.resolve("width"));
+
+      // shadowing the name in between replaces the remembered symbol
+      square.insert("width", make_symbol("width", symbol_type::e_member_variable));
+      CHECK(func_table.resolve("width") == square.resolve("width"));
+
+      // once removed, the symbol of the base class is found again
+      square.remove("width");
+      CHECK(func_table.resolve("width") == shape.resolve("width"));
+
+      shape.remove("width");
+      CHECK_FALSE(func_table.resolve("width"));
+
+      shape.insert("width", make_symbol("width", symbol_type::e_member_variable));
+      CHECK(func_table.resolve("width") == shape.resolve("width"));
+   }
+   TEST_CASE("resolved names are forgotten past tables that missed them")
+   {
+      SUBCASE("a base found before the one that held the name")
+      {
+         symbol_table base0{"base0", symbol_table_type::e_class};
+         symbol_table rect{"rect", symbol_table_type::e_class};
+         symbol_table shape{"shape", symbol_table_type::e_class};
+         symbol_table square{"square", symbol_table_type::e_class};
+         symbol_table func_table{"square::area", symbol_table_type::e_func};
+
+         REQUIRE(rect.add_base(&base0));
+         REQUIRE(square.add_base(&rect));
+         REQUIRE(square.add_base(&shape));
+         func_table.set_parent(&square);
+
+         shape.insert("width", make_symbol("width", symbol_type::e_member_variable));
+         REQUIRE(func_table.resolve("width") == shape.resolve("width"));
+
+         // rect never found the name, yet the tables below it have to forget it
+         base0.insert("width", make_symbol("width", symbol_type::e_member_variable));
+         CHECK(square.resolve("width") == base0.resolve("width"));
+         CHECK(func_table.resolve("width") == base0.resolve("width"));
+      }
+      SUBCASE("a base found before the parent that held the name")
+      {
+         symbol_table global{"global", symbol_table_type::e_translation_unit};
+         symbol_table a{"a", symbol_table_type::e_class};
+         symbol_table b{"b", symbol_table_type::e_class};
+         symbol_table c{"c", symbol_table_type::e_class};
+
+         REQUIRE(b.add_base(&a));
+         REQUIRE(c.add_base(&b));
+         c.set_parent(&global);
+
+         global.insert("x", make_symbol("x", symbol_type::e_variable));
+         REQUIRE(c.resolve("x") == global.resolve("x"));
+
+         a.insert("x", make_symbol("x", symbol_type::e_member_variable));
+         CHECK(c.resolve("x") == a.resolve("x"));
+      }
+   }
+   TEST_CASE("resolved names are forgotten by dependents when a parent or base changes")
+   {
+      symbol_table global{"global", symbol_table_type::e_translation_unit};
+      symbol_table shape{"shape", symbol_table_type::e_class};
+      symbol_table square{"square", symbol_table_type::e_class};
+      symbol_table func_table{"square::area", symbol_table_type::e_func};
+      symbol_table block{"square::area::block", symbol_table_type::e_func};
+
+      square.set_parent(&global);
+      func_table.set_parent(&square);
+      block.set_parent(&func_table);
+
+      global.insert("width", make_symbol("width", symbol_type::e_variable));
+      REQUIRE(block.resolve("width") == global.resolve("width"));
+
+      // a new base of the class hides the global from the tables below it
+      shape.insert("width", make_symbol("width", symbol_type::e_member_variable));
+      REQUIRE(square.add_base(&shape));
+      CHECK(func_table.resolve("width") == shape.resolve("width"));
+      CHECK(block.resolve("width") == shape.resolve("width"));
+
+      // so does a new parent of the class
+      symbol_table other{"other", symbol_table_type::e_translation_unit};
+      other.insert("height", make_symbol("height", symbol_type::e_variable));
+      global.insert("height", make_symbol("height", symbol_type::e_variable));
+      REQUIRE(block.resolve("height") == global.resolve("height"));
+
+      square.set_parent(&other);
+      CHECK(block.resolve("height") == other.resolve("height"));
+      CHECK(block.resolve("width") == shape.resolve("width"));
+   }
+   TEST_CASE("resolving from several threads")
+   {
+      symbol_table shape{"shape", symbol_table_type::e_class};
+      std::vector<std::unique_ptr<symbol_table>> funcs;
+      for (int i = 0; i < 8; ++i)
+      {
+         funcs.push_back(std::make_unique<symbol_table>(fmt::format("shape::f{}", i),
+                                                        symbol_table_type::e_func));
+         funcs.back()->set_parent(&shape);
+      }
+
+      // the functions all go through the table of the class, which remembers what it finds
+      symbol_table named{"named", symbol_table_type::e_class};
+      REQUIRE(shape.add_base(&named));
+
+      named.insert("width", make_symbol("width", symbol_type::e_member_variable));
+      const auto* p_width = named.resolve("width");
+
+      std::vector<const symbol*> resolved(std::size(funcs));
+      util::parallel_for(std::size(funcs), 4, [&](std::size_t i) {
+         resolved[i] = funcs[i]->resolve("width");
+      });
+
+      for (const auto* p_symbol : resolved)
+      {
+         CHECK(p_symbol == p_width);
+      }
+   }
+}
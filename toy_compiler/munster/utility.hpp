@@ -21,39 +21,152 @@
 
 #include <toy_compiler/munster/grammar/token_type.hpp>
 
+#include <array>
 #include <string_view>
-
-#include <range/v3/algorithm/find.hpp>
+#include <utility>
 
 namespace munster
 {
+   /**
+    * @brief The classes of characters the lexer makes a distinction between.
+    */
+   enum struct char_class : std::uint8_t
+   {
+      e_space,
+      e_whitespace,
+      e_newline,
+      e_letter,
+      e_letter_e, // used as the start of the exponent of float literals
+      e_zero,
+      e_nonzero_digit,
+      e_underscore,
+      e_quote,
+      e_period,
+      e_comma,
+      e_colon,
+      e_semi_colon,
+      e_plus,
+      e_minus,
+      e_star,
+      e_slash,
+      e_equal,
+      e_less_than,
+      e_greater_than,
+      e_pipe,
+      e_ampersand,
+      e_exclamation,
+      e_qmark,
+      e_open_parenth,
+      e_close_parenth,
+      e_open_square,
+      e_close_square,
+      e_open_curly,
+      e_close_curly,
+      e_other,
+      e_eof, // never produced by `classify`, used by the lexer once the end of data is reached
+      e_max_size
+   };
+
    namespace detail
    {
-      constexpr std::array alphabet{
-         std::to_array("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz")};
-      constexpr std::array digits{std::to_array("0123456789")};
-      constexpr std::array operators{std::to_array("=+-*/<>|&!?")};
-      constexpr std::array punctuations{grammar::period, grammar::comma, grammar::colon,
-                                        grammar::semi_colon};
+      constexpr std::string_view alphabet{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"};
+      constexpr std::string_view whitespaces{"\f\r\t\v"};
+      constexpr std::array operators{std::pair{'=', char_class::e_equal},
+                                     std::pair{'+', char_class::e_plus},
+                                     std::pair{'-', char_class::e_minus},
+                                     std::pair{'*', char_class::e_star},
+                                     std::pair{'/', char_class::e_slash},
+                                     std::pair{'<', char_class::e_less_than},
+                                     std::pair{'>', char_class::e_greater_than},
+                                     std::pair{'|', char_class::e_pipe},
+                                     std::pair{'&', char_class::e_ampersand},
+                                     std::pair{'!', char_class::e_exclamation},
+                                     std::pair{'?', char_class::e_qmark}};
+      constexpr std::array punctuations{std::pair{grammar::period, char_class::e_period},
+                                        std::pair{grammar::comma, char_class::e_comma},
+                                        std::pair{grammar::colon, char_class::e_colon},
+                                        std::pair{grammar::semi_colon, char_class::e_semi_colon}};
+      constexpr std::array braces{std::pair{grammar::open_parenth, char_class::e_open_parenth},
+                                  std::pair{grammar::close_parenth, char_class::e_close_parenth},
+                                  std::pair{grammar::open_square, char_class::e_open_square},
+                                  std::pair{grammar::close_square, char_class::e_close_square},
+                                  std::pair{grammar::open_curly, char_class::e_open_curly},
+                                  std::pair{grammar::close_curly, char_class::e_close_curly}};
       constexpr std::array comments{"/*", "//"};
-      constexpr std::array braces{grammar::open_parenth, grammar::close_parenth,
-                                  grammar::open_square,  grammar::close_square,
-                                  grammar::open_curly,   grammar::close_curly};
+
+      constexpr auto make_char_class_table() -> std::array<char_class, 256>
+      {
+         std::array<char_class, 256> table{};
+         table.fill(char_class::e_other);
+
+         const auto set = [&](char c, char_class type) {
+            table.at(static_cast<unsigned char>(c)) = type;
+         };
+
+         for (char c : alphabet)
+         {
+            set(c, char_class::e_letter);
+         }
+         for (char c : whitespaces)
+         {
+            set(c, char_class::e_whitespace);
+         }
+         for (const auto& [c, type] : operators)
+         {
+            set(c, type);
+         }
+         for (const auto& [c, type] : punctuations)
+         {
+            set(c, type);
+         }
+         for (const auto& [c, type] : braces)
+         {
+            set(c, type);
+         }
+
+         set('e', char_class::e_letter_e);
+         set('0', char_class::e_zero);
+         for (char c = '1'; c <= '9'; ++c)
+         {
+            set(c, char_class::e_nonzero_digit);
+         }
+         set(' ', char_class::e_space);
+         set('_', char_class::e_underscore);
+         set('\"', char_class::e_quote);
+         set('\n', char_class::e_newline);
+
+         return table;
+      }
+
+      /**
+       * @brief The `munster::char_class` of every possible value of a char
+       */
+      constexpr auto char_classes = make_char_class_table();
    } // namespace detail
 
+   /**
+    * @brief Get the `munster::char_class` of a character
+    */
+   constexpr auto classify(char c) noexcept -> char_class
+   {
+      return detail::char_classes[static_cast<unsigned char>(c)]; // NOLINT
+   }
+
    /**
     * @brief Check if a character is a letter from [a-zA-Z]
     */
    constexpr auto is_alphabet(char c) noexcept -> bool
    {
-      return ranges::find(detail::alphabet, c) != std::end(detail::alphabet);
+      const auto type = classify(c);
+      return type == char_class::e_letter || type == char_class::e_letter_e;
    }
    /**
     * @brief Check if a character is a number between [0, 9]
     */
    constexpr auto is_digit(char c) noexcept -> bool
    {
-      return ranges::find(detail::digits, c) != std::end(detail::digits);
+      const auto type = classify(c);
+      return type == char_class::e_zero || type == char_class::e_nonzero_digit;
    }
    /**
     * @brief Check if a character is a letter from [a-zA-Z] or a number between [0, 9]
@@ -67,21 +180,24 @@ namespace munster
     */
    constexpr auto is_punctuation(char c) noexcept -> bool
    {
-      return ranges::find(detail::punctuations, c) != std::end(detail::punctuations);
+      const auto type = classify(c);
+      return type >= char_class::e_period && type <= char_class::e_semi_colon;
    }
    /**
     * @brief Check if a character is an operator (=+-*<>/|&!?)
     */
    constexpr auto is_operator(char c) noexcept -> bool
    {
-      return ranges::find(detail::operators, c) != std::end(detail::operators);
+      const auto type = classify(c);
+      return type >= char_class::e_plus && type <= char_class::e_qmark;
    }
    /**
     * @brief Check if a character is brace character ([](){})
     */
    constexpr auto is_braces(char c) noexcept -> bool
    {
-      return ranges::find(detail::braces, c) != std::end(detail::braces);
+      const auto type = classify(c);
+      return type >= char_class::e_open_parenth && type <= char_class::e_close_curly;
    }
    /**
     * @brief Check if a character is a quotation (")
@@ -91,12 +207,21 @@ namespace munster
     * @brief Check if a character is a newline character
     */
    constexpr auto is_newline(char c) noexcept -> bool { return c == '\n'; }
+   /**
+    * @brief Check if a character is a whitespace, newlines included
+    */
+   constexpr auto is_whitespace(char c) noexcept -> bool
+   {
+      const auto type = classify(c);
+      return type == char_class::e_space || type == char_class::e_whitespace ||
+         type == char_class::e_newline;
+   }
    /**
     * @brief Check if a character is a line or block comment character
     */
    constexpr auto is_comment(std::string_view str) -> bool
    {
-      return ranges::find(detail::comments, str) != std::end(detail::comments);
+      return str == detail::comments[0] || str == detail::comments[1];
    }
 
    /**
@@ -14,15 +14,12 @@
 #include <toy_compiler/munster/ast/op/mult_op.hpp>
 #include <toy_compiler/munster/ast/op/rel_op.hpp>
 
-#include <range/v3/numeric/accumulate.hpp>
-#include <range/v3/range/conversion.hpp>
-#include <range/v3/view/drop.hpp>
+#include <magic_enum.hpp>
+
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/map.hpp>
-#include <range/v3/view/reverse.hpp>
-#include <range/v3/view/split.hpp>
-#include <range/v3/view/tail.hpp>
-#include <range/v3/view/transform.hpp>
+
+#include <cassert>
 
 namespace rv = ranges::views;
 
@@ -30,22 +27,15 @@ namespace munster
 {
    code_gen_visitor::code_gen_visitor(symbol_table* p_root) : mp_root{p_root} {}
 
-   void code_gen_visitor::place_marker(std::string marker)
+   void code_gen_visitor::begin_stmt_block()
    {
-      m_blocks.push_back(std::move(marker));
+      m_stmt_block_starts.push_back(std::size(m_fragments));
    }
 
-   auto code_gen_visitor::moon_code() -> std::string_view { return moon_code_output; }
+   auto code_gen_visitor::take_program() -> ir::program { return std::move(m_program); }
 
    namespace
    {
-      auto pop_back(std::vector<std::string>& stack) -> std::string
-      {
-         auto temp = std::move(*(std::end(stack) - 1));
-         stack.pop_back();
-         return temp;
-      }
-
       auto is_temp(const symbol& symbol) -> bool
       {
          return symbol.kind() == symbol_type::e_temporary;
@@ -56,89 +46,114 @@ namespace munster
          return symbol.kind() == symbol_type::e_parameter;
       }
 
-      auto trim_leading_whitespaces(std::string_view str) -> std::string_view
+      /**
+       * @brief Add the instruction at the end of the code, in a new block if the last block
+       * already ends with a terminator
+       */
+      void append(std::vector<ir::basic_block>& code, ir::instruction&& instr)
       {
-         const std::size_t first = str.find_first_not_of(' ');
+         if (std::empty(code) ||
+             (!std::empty(code.back().instructions) &&
+              ir::is_terminator(code.back().instructions.back().op)))
+         {
+            code.emplace_back();
+         }
 
-         if (first == std::string::npos)
+         code.back().instructions.push_back(std::move(instr));
+      }
+      void append(std::vector<ir::basic_block>& code, std::vector<ir::instruction>&& instrs)
+      {
+         for (auto& instr : instrs)
          {
-            return str;
+            append(code, std::move(instr));
          }
-         else
+      }
+      /**
+       * @brief Add the blocks at the end of the code, a first block without a label falls
+       * through from the last block of the code so it is merged into it
+       */
+      void append(std::vector<ir::basic_block>& code, std::vector<ir::basic_block>&& blocks)
+      {
+         for (auto& block : blocks)
          {
-            return str.substr(first, std::size(str));
+            if (std::empty(block.label) && !std::empty(code) &&
+                (std::empty(code.back().instructions) ||
+                 !ir::is_terminator(code.back().instructions.back().op)))
+            {
+               append(code, std::move(block.instructions));
+            }
+            else
+            {
+               code.push_back(std::move(block));
+            }
          }
       }
+      void append_label(std::vector<ir::basic_block>& code, std::string label)
+      {
+         code.push_back({.label = std::move(label)});
+      }
    } // namespace
 
    static auto is_var(const symbol& symbol) -> bool
    {
       return symbol.kind() == symbol_type::e_variable;
    }
-   static auto is_integer_lit(const symbol& symbol) -> bool
-   {
-      return symbol.kind() == symbol_type::e_integer_lit;
-   }
-   static auto is_float_lit(const symbol& symbol) -> bool
-   {
-      return symbol.kind() == symbol_type::e_float_lit;
-   }
 
-   static auto convert_add_op(std::string_view value) -> std::string
+   static auto convert_add_op(std::string_view value) -> ir::opcode
    {
       if (value == "+")
       {
-         return "add";
+         return ir::opcode::e_add;
       }
       else if (value == "-")
       {
-         return "sub";
+         return ir::opcode::e_sub;
       }
       else
       {
-         return "or";
+         return ir::opcode::e_or;
       }
    }
-   static auto convert_mult_op(std::string_view value) -> std::string
+   static auto convert_mult_op(std::string_view value) -> ir::opcode
    {
       if (value == "*")
       {
-         return "mul";
+         return ir::opcode::e_mul;
       }
       else if (value == "/")
       {
-         return "div";
+         return ir::opcode::e_div;
       }
       else
       {
-         return "and";
+         return ir::opcode::e_and;
       }
    }
-   static auto convert_rel_op(std::string_view value) -> std::string
+   static auto convert_rel_op(std::string_view value) -> ir::opcode
    {
       if (value == "==")
       {
-         return "ceq";
+         return ir::opcode::e_eq;
       }
       else if (value == "!=")
       {
-         return "cne";
+         return ir::opcode::e_ne;
       }
       else if (value == "<")
       {
-         return "clt";
+         return ir::opcode::e_lt;
       }
       else if (value == ">")
       {
-         return "cgt";
+         return ir::opcode::e_gt;
       }
       else if (value == "<=")
       {
-         return "cle";
+         return ir::opcode::e_le;
       }
       else
       {
-         return "cge";
+         return ir::opcode::e_ge;
       }
    }
 
@@ -147,32 +162,18 @@ namespace munster
       for (auto& symbol : mp_root->symbols() | rv::values)
       {
          const auto* p_table = symbol.link();
-         for (auto& symbol : p_table->symbols() | rv::values | rv::filter(is_var))
-         {
-            std::string_view var_name{symbol.name()};
-
-            const std::string label{fmt::format("{}_{}", p_table->name(), var_name)};
-
-            moon_code_output += fmt::format("{:<30} {} {}\n", label, "res", symbol.size());
-         }
-
-         for (auto& symbol : p_table->symbols() | rv::values | rv::filter(is_param))
-         {
-            std::string_view var_name{symbol.name()};
-
-            const std::string label{fmt::format("{}_{}", p_table->name(), var_name)};
-
-            moon_code_output += fmt::format("{:<30} {} {}\n", label, "res", symbol.size());
-         }
-
-         for (auto& symbol : p_table->symbols() | rv::values | rv::filter(is_temp))
-         {
-            std::string_view var_name{symbol.name()};
-
-            const std::string label{fmt::format("{}_{}", p_table->name(), var_name)};
+         const auto reserve = [&](auto symbols) {
+            for (auto& symbol : symbols)
+            {
+               m_program.data.push_back(
+                  {.label = fmt::format("{}_{}", p_table->name(), symbol.name()),
+                   .size = symbol.size()});
+            }
+         };
 
-            moon_code_output += fmt::format("{:<30} {} {}\n", label, "res", symbol.size());
-         }
+         reserve(p_table->symbols() | rv::values | rv::filter(is_var));
+         reserve(p_table->symbols() | rv::values | rv::filter(is_param));
+         reserve(p_table->symbols() | rv::values | rv::filter(is_temp));
       }
    }
 
@@ -190,11 +191,7 @@ namespace munster
    {
       if (!node.class_name())
       {
-         const auto func_name = node.lexeme();
-         const auto key = fmt::format("{} '{} ({})'", func_name, node.return_type(),
-                                      fmt::join(node.params(), ", "));
-
-         if (auto func_entry_res = mp_root->lookup(key))
+         if (auto func_entry_res = mp_root->lookup(node.signature()))
          {
             m_tables.push_back(func_entry_res.val().link());
          }
@@ -212,51 +209,41 @@ namespace munster
                                          .size = 4,
                                          .type = "None"}});
 
-         const auto function_block = ranges::accumulate(m_blocks, std::string{});
+         auto code = take_function_code();
+         append(code, {.op = ir::opcode::e_return,
+                       .label = fmt::format("{}_{}", m_tables.back()->name(), name)});
 
-         m_blocks.clear();
-
-         const auto label = fmt::format("fn_{}_{}", m_tables.back()->name(), m_function_counter++);
-
-         moon_code_output += fmt::format("{} {}", label, trim_leading_whitespaces(function_block));
-         moon_code_output += fmt::format("{}lw r15, {}\n", spacing, name);
-         moon_code_output += fmt::format("{}jr r15\n\n", spacing);
+         m_program.functions.push_back(
+            {.label = fmt::format("fn_{}_{}", m_tables.back()->name(), m_function_counter++),
+             .kind = ir::function_kind::e_function,
+             .blocks = std::move(code)});
       }
    }
    void code_gen_visitor::visit(const ast::stmt_block_decl&)
    {
-      const auto reverse_view = m_blocks | rv::reverse;
-      const auto it = ranges::find(reverse_view, std::string{"stmt_block"});
-
-      const std::int64_t dist_to_marker = std::distance(it, std::end(reverse_view));
-      const std::span stmt_data{std::begin(m_blocks) + dist_to_marker, std::end(m_blocks)};
-      const std::string stmt_block = ranges::accumulate(stmt_data, std::string{});
+      assert(!std::empty(m_stmt_block_starts)); // NOLINT
 
-      m_blocks.erase(std::begin(m_blocks) + dist_to_marker - 1, std::end(m_blocks));
+      const auto first = std::begin(m_fragments) +
+         static_cast<std::ptrdiff_t>(m_stmt_block_starts.back());
+      m_stmt_block_starts.pop_back();
 
-      const std::size_t first = stmt_block.find_first_not_of(' ');
-
-      if (first == std::string::npos)
-      {
-         m_blocks.emplace_back(stmt_block);
-      }
-      else
+      fragment block;
+      for (auto it = first; it != std::end(m_fragments); ++it)
       {
-         m_blocks.push_back(stmt_block.substr(first, std::size(stmt_block)));
+         append(block, std::move(*it));
       }
+
+      m_fragments.erase(first, std::end(m_fragments));
+      m_fragments.push_back(std::move(block));
    }
 
    void code_gen_visitor::visit(const ast::main_decl&)
    {
-      moon_code_output += fmt::format("{}{}\n", spacing, "entry");
-      moon_code_output += fmt::format("{}{}\n\n", spacing, "addi r14, r0, topaddr");
-
-      for (const auto& block : m_blocks)
-      {
-         moon_code_output += block;
-      }
+      auto code = take_function_code();
+      append(code, {.op = ir::opcode::e_halt});
 
-      moon_code_output += fmt::format("{}hlt\n\n", spacing);
+      m_program.functions.push_back(
+         {.label = "main", .kind = ir::function_kind::e_main, .blocks = std::move(code)});
    }
 
    void code_gen_visitor::visit(const ast::compound_params_decl&) {}
@@ -277,66 +264,23 @@ namespace munster
    }
    void code_gen_visitor::visit(const ast::var_expr& node)
    {
-      const std::string var_name{node.lexeme()};
-
-      if (std::size(m_tables) == 1u)
+      if (std::empty(m_tables))
       {
-         symbol_table* func_table = *(std::end(m_tables) - 1);
-
-         if (const auto res = func_table->lookup(var_name))
-         {
-            m_symbols.push_back(&res.val());
-         }
+         return;
       }
-      else if (std::size(m_tables) == 2u)
-      {
-         symbol_table* p_func_table = *(std::end(m_tables) - 1);
-         symbol_table* p_class_table = *(std::end(m_tables) - 2);
-
-         symbol* p_symbol = nullptr;
-         if (const auto res = p_func_table->lookup(var_name))
-         {
-            p_symbol = &res.val();
-         }
-
-         if (!p_symbol)
-         {
-            if (const auto res = p_class_table->lookup(var_name))
-            {
-               p_symbol = &res.val();
-            }
-         }
 
-         m_symbols.push_back(p_symbol);
+      if (const symbol* p_symbol = m_tables.back()->resolve(node.lexeme_id()))
+      {
+         m_operands.push_back({.p_symbol = p_symbol});
       }
    }
    void code_gen_visitor::visit(const ast::float_expr& node)
    {
-      auto* func_table = m_tables.back();
-
-      const auto name = fmt::format("float_lit_{}", m_literal_counter++);
-      const auto res = func_table->insert(name,
-                                          symbol{{.name = name,
-                                                  .kind = symbol_type::e_float_lit,
-                                                  .location = node.location(),
-                                                  .size = 4,
-                                                  .type = "float"}});
-
-      m_symbols.push_back(&res.val());
+      m_operands.push_back({.literal = std::string{node.lexeme()}});
    }
    void code_gen_visitor::visit(const ast::integer_expr& node)
    {
-      auto* func_table = m_tables.back();
-
-      const auto name = fmt::format("integer_lit_{}", m_literal_counter++);
-      const auto res = func_table->insert(name,
-                                          symbol{{.name = name,
-                                                  .kind = symbol_type::e_integer_lit,
-                                                  .location = node.location(),
-                                                  .size = 4,
-                                                  .type = "integer"}});
-
-      m_symbols.push_back(&res.val());
+      m_operands.push_back({.literal = std::string{node.lexeme()}});
    }
    void code_gen_visitor::visit(const ast::string_expr&) {}
 
@@ -351,442 +295,218 @@ namespace munster
    void code_gen_visitor::visit(const ast::assign_stmt&) {}
    void code_gen_visitor::visit(const ast::if_stmt&)
    {
-      symbol_table* p_table = m_tables.back();
-
-      const symbol* p_expr_sym = m_symbols.back();
-
-      const auto r1 = m_register_pool.pop().value();
-
-      const auto temp_label = fmt::format("{}_{}", p_table->name(), p_expr_sym->name());
-      const auto else_label = fmt::format("else_{}", m_if_counter);
-      const auto end_label = fmt::format("if_end_{}", m_if_counter++);
-
-      const auto comment = "% if statement";
-      const auto load = fmt::format("{}lw {}, {}(r0) {}\n", spacing, r1, temp_label, comment);
-      const auto if_cmd = fmt::format("{}bz {}, {}\n", spacing, r1, else_label);
-      const auto else_block = pop_back(m_blocks);
-      const auto then_block = pop_back(m_blocks);
-
-      m_blocks.push_back(fmt::format("{}{}", load, if_cmd));
-      m_blocks.push_back(fmt::format("{}{}", spacing, then_block));
-      m_blocks.push_back(fmt::format("{}j {}\n", spacing, end_label));
-      m_blocks.push_back(fmt::format("{:<9} {}\n", else_label, else_block));
-      m_blocks.push_back(fmt::format("{}\n", end_label));
-
-      m_register_pool.push(r1);
+      auto else_label = fmt::format("else_{}", m_if_counter);
+      auto end_label = fmt::format("if_end_{}", m_if_counter++);
+
+      std::vector<ir::instruction> condition;
+      const auto value = take_value(pop_operand(), condition);
+
+      auto else_block = pop_fragment();
+      auto then_block = pop_fragment();
+
+      fragment code;
+      append(code, std::move(condition));
+      append(code, {.op = ir::opcode::e_branch_zero,
+                    .lhs = value,
+                    .label = else_label,
+                    .comment = "% if statement"});
+      append(code, std::move(then_block));
+      append(code, {.op = ir::opcode::e_jump, .label = end_label});
+      append_label(code, std::move(else_label));
+      append(code, std::move(else_block));
+      append_label(code, std::move(end_label));
+
+      m_fragments.push_back(std::move(code));
    }
    void code_gen_visitor::visit(const ast::while_stmt&)
    {
-      symbol_table* p_table = m_tables.back();
-
-      const symbol* p_expr_sym = m_symbols.back();
-
-      const auto r1 = m_register_pool.pop().value();
-
-      const auto temp_label = fmt::format("{}_{}", p_table->name(), p_expr_sym->name());
-      const auto beg_while_label = fmt::format("wh_beg_{}", m_if_counter);
-      const auto end_while_label = fmt::format("wh_end_{}", m_if_counter++);
-
-      const auto comment = "% while statement";
-      const auto load = fmt::format("{}lw {}, {}(r0) {}\n", spacing, r1, temp_label, comment);
-      const auto while_cmd = fmt::format("{}bz {}, {}\n", spacing, r1, end_while_label);
-      const auto while_block = pop_back(m_blocks);
-
-      const auto comparison = pop_back(m_blocks);
-
-      m_blocks.push_back(
-         fmt::format("{:<10}{}", beg_while_label, trim_leading_whitespaces(comparison)));
-      m_blocks.push_back(fmt::format("{}{}", load, while_cmd));
-      m_blocks.push_back(fmt::format("{}{}", spacing, while_block));
-      m_blocks.push_back(fmt::format("{}j {}\n", spacing, beg_while_label));
-      m_blocks.push_back(fmt::format("{}\n", end_while_label));
-
-      m_register_pool.push(r1);
+      auto beg_while_label = fmt::format("wh_beg_{}", m_if_counter);
+      auto end_while_label = fmt::format("wh_end_{}", m_if_counter++);
+
+      std::vector<ir::instruction> condition;
+      const auto value = take_value(pop_operand(), condition);
+
+      auto while_block = pop_fragment();
+
+      fragment code;
+      append_label(code, beg_while_label);
+      append(code, std::move(condition));
+      append(code, {.op = ir::opcode::e_branch_zero,
+                    .lhs = value,
+                    .label = end_while_label,
+                    .comment = "% while statement"});
+      append(code, std::move(while_block));
+      append(code, {.op = ir::opcode::e_jump, .label = std::move(beg_while_label)});
+      append_label(code, std::move(end_while_label));
+
+      m_fragments.push_back(std::move(code));
    }
    void code_gen_visitor::visit(const ast::read_stmt&)
    {
-      if (!std::empty(m_symbols))
+      if (!std::empty(m_operands))
       {
-         m_symbols.pop_back();
+         m_operands.pop_back();
       }
    }
    void code_gen_visitor::visit(const ast::write_stmt&)
    {
-      if (!std::empty(m_symbols))
+      if (!std::empty(m_operands))
       {
-         m_symbols.pop_back();
+         m_operands.pop_back();
       }
    }
    void code_gen_visitor::visit(const ast::return_stmt&)
    {
-      if (!std::empty(m_symbols))
+      if (!std::empty(m_operands))
       {
-         m_symbols.pop_back();
+         m_operands.pop_back();
       }
    }
    void code_gen_visitor::visit(const ast::break_stmt&) {}
    void code_gen_visitor::visit(const ast::continue_stmt&) {}
 
    void code_gen_visitor::visit(const ast::dot_op&) {}
-   void code_gen_visitor::visit(const ast::assign_op& node)
+   void code_gen_visitor::visit(const ast::assign_op&)
    {
       // TODO: remove
-      if (std::size(m_symbols) < 2)
+      if (std::size(m_operands) < 2)
       {
-         if (!std::empty(m_symbols))
+         if (!std::empty(m_operands))
          {
-            m_symbols.pop_back();
+            m_operands.pop_back();
          }
 
          return;
       }
 
-      symbol_table* p_table = m_tables.back();
-
-      const symbol* p_left_symbol = *(std::end(m_symbols) - 2);
-      const symbol* p_right_symbol = *(std::end(m_symbols) - 1);
-
-      const std::string left_label{fmt::format("{}_{}", p_table->name(), p_left_symbol->name())};
-
-      const auto cmt = "% assign op";
-      if (is_float_lit(*p_right_symbol) || is_integer_lit(*p_right_symbol))
+      auto right = pop_operand();
+      const auto left = pop_operand();
+      if (!left.p_symbol)
       {
-         const auto value = node.children()[1]->lexeme();
-         const std::string sub = fmt::format("{}sub r1, r1, r1 {}\n", spacing, cmt);
-         const std::string addi = fmt::format("{}addi r1, r1, {}\n", spacing, value);
-         const std::string store = fmt::format("{}sw {}(r0), r1\n\n", spacing, left_label);
-
-         m_blocks.push_back(fmt::format("{}{}{}", sub, addi, store));
+         return;
       }
-      else
-      {
-         const auto right_label = fmt::format("{}_{}", p_table->name(), p_right_symbol->name());
-
-         const std::string load = fmt::format("{}lw r1, {}(r0) {}\n", spacing, right_label, cmt);
-         const std::string store = fmt::format("{}sw {}(r0), r1\n\n", spacing, left_label);
 
-         m_blocks.push_back(fmt::format("{}{}", load, store));
-      }
+      std::vector<ir::instruction> code;
+      const auto value = take_value(std::move(right), code);
+      code.push_back(
+         {.op = ir::opcode::e_store,
+          .lhs = value,
+          .label = fmt::format("{}_{}", m_tables.back()->name(), left.p_symbol->name())});
+      code.front().comment = "% assign op";
 
-      m_symbols.pop_back();
-      m_symbols.pop_back();
+      fragment statement;
+      append(statement, std::move(code));
+      m_fragments.push_back(std::move(statement));
    }
    void code_gen_visitor::visit(const ast::add_op& node)
    {
-      if (std::size(m_symbols) < 2)
+      handle_binary_op(convert_add_op(node.lexeme()));
+   }
+   void code_gen_visitor::visit(const ast::mult_op& node)
+   {
+      handle_binary_op(convert_mult_op(node.lexeme()));
+   }
+   void code_gen_visitor::visit(const ast::rel_op& node)
+   {
+      handle_binary_op(convert_rel_op(node.lexeme()));
+   }
+
+   void code_gen_visitor::handle_binary_op(ir::opcode op)
+   {
+      if (std::size(m_operands) < 2)
       {
-         if (!std::empty(m_symbols))
+         if (!std::empty(m_operands))
          {
-            m_symbols.pop_back();
+            m_operands.pop_back();
          }
 
          return;
       }
 
-      symbol_table* p_table = m_tables.back();
-
-      const symbol* p_left_symbol = *(std::end(m_symbols) - 2);
-      const symbol* p_right_symbol = *(std::end(m_symbols) - 1);
+      auto right = pop_operand();
+      auto left = pop_operand();
 
-      const std::string left_label{fmt::format("{}_{}", p_table->name(), p_left_symbol->name())};
-      const std::string right_label{fmt::format("{}_{}", p_table->name(), p_right_symbol->name())};
+      operand result;
+      const auto lhs = take_value(std::move(left), result.code);
+      result.value = ir::virtual_register{m_value_counter++};
 
-      const auto r1 = m_register_pool.pop().value();
-
-      const auto name = fmt::format("temp{}", m_temporary_counter++);
-      const auto res = p_table->insert(name,
-                                       symbol{{.name = name,
-                                               .kind = symbol_type::e_temporary,
-                                               .location = node.location(),
-                                               .size = p_right_symbol->size(),
-                                               .type = std::string{p_right_symbol->type()}}});
-
-      const auto temp_label = fmt::format("{}_{}", p_table->name(), res.val().name());
-
-      const auto operation = convert_add_op(node.lexeme());
-      const auto cmt = fmt::format("% {} op", operation);
-
-      if (is_float_lit(*p_right_symbol) || is_integer_lit(*p_right_symbol))
+      const auto comment = fmt::format("% {} op", magic_enum::enum_name(op).substr(2));
+      if (!right.value && !right.p_symbol)
       {
-         if (is_float_lit(*p_left_symbol) || is_integer_lit(*p_left_symbol))
-         {
-            const auto addi_left = fmt::format("{0}{2}i {1}, r0, {3} {4}\n", spacing, r1, operation,
-                                               node.children()[0]->lexeme(), cmt);
-            const auto addi_right = fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, operation,
-                                                node.children()[1]->lexeme());
-            /*
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-               */
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", addi_left, addi_right, store));
-         }
-         else
-         {
-            const auto load_left =
-               fmt::format("{0}lw {1}, {2}(r0) {3}\n", spacing, r1, left_label, cmt);
-            const auto addi_right =
-               fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, convert_add_op(node.lexeme()),
-                           node.children()[1]->lexeme());
-            /*
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            */
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", load_left, addi_right, store));
-         }
+         result.code.push_back({.op = op,
+                                .dest = result.value.value(),
+                                .lhs = lhs,
+                                .immediate = std::move(right.literal),
+                                .comment = comment});
       }
       else
       {
-         const auto r2 = m_register_pool.pop().value();
-
-         if (is_float_lit(*p_left_symbol) || is_integer_lit(*p_left_symbol))
-         {
-            const auto load_right =
-               fmt::format("{0}lw {1}, {2}(r0) {3}\n", spacing, r1, right_label, cmt);
-            const auto addi_left =
-               fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, convert_add_op(node.lexeme()),
-                           node.children()[0]->lexeme());
-            /*
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-               */
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", load_right, addi_left, store));
-         }
-         else
-         {
-            const auto load_left =
-               fmt::format("{0}lw {1}, {2}(r0) {3}\n", spacing, r1, left_label, cmt);
-            const auto load_right = fmt::format("{0}lw {1}, {2}(r0)\n", spacing, r2, right_label);
-            const auto add = fmt::format("{0}{3} {1}, {1}, {2}\n", spacing, r1, r2,
-                                         convert_add_op(node.lexeme()));
-            /*
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-               */
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}{}", load_left, load_right, add, store));
-         }
-
-         m_register_pool.push(r2);
+         const auto rhs = take_value(std::move(right), result.code);
+         result.code.push_back({.op = op,
+                                .dest = result.value.value(),
+                                .lhs = lhs,
+                                .rhs = rhs,
+                                .comment = comment});
       }
 
-      m_register_pool.push(r1);
-
-      m_symbols.pop_back();
-      m_symbols.pop_back();
-
-      m_symbols.push_back(&res.val());
+      m_operands.push_back(std::move(result));
    }
-   void code_gen_visitor::visit(const ast::mult_op& node)
+
+   auto code_gen_visitor::take_value(operand&& op, std::vector<ir::instruction>& code)
+      -> ir::virtual_register
    {
-      if (std::size(m_symbols) < 2)
+      if (op.value)
       {
-         if (!std::empty(m_symbols))
-         {
-            m_symbols.pop_back();
-         }
+         code.insert(std::end(code), std::make_move_iterator(std::begin(op.code)),
+                     std::make_move_iterator(std::end(op.code)));
 
-         return;
+         return op.value.value();
       }
 
-      symbol_table* p_table = m_tables.back();
-
-      const symbol* p_left_symbol = *(std::end(m_symbols) - 2);
-      const symbol* p_right_symbol = *(std::end(m_symbols) - 1);
-
-      const std::string left_label{fmt::format("{}_{}", p_table->name(), p_left_symbol->name())};
-      const std::string right_label{fmt::format("{}_{}", p_table->name(), p_right_symbol->name())};
-
-      const auto r1 = m_register_pool.pop().value();
-
-      const auto name = fmt::format("temp{}", m_temporary_counter++);
-      const auto res = p_table->insert(name,
-                                       symbol{{.name = name,
-                                               .kind = symbol_type::e_temporary,
-                                               .location = node.location(),
-                                               .size = p_right_symbol->size(),
-                                               .type = std::string{p_right_symbol->type()}}});
-
-      [[maybe_unused]] const auto& test = res.val();
-
-      const auto temp_label = fmt::format("{}_{}", p_table->name(), res.val().name());
-
-      const auto cmt = "% mult op";
-      if (is_float_lit(*p_right_symbol) || is_integer_lit(*p_right_symbol))
+      const auto value = ir::virtual_register{m_value_counter++};
+      if (op.p_symbol)
       {
-         if (is_float_lit(*p_left_symbol) || is_integer_lit(*p_left_symbol))
-         {
-            const auto muli_left =
-               fmt::format("{0}{2}i {1}, r0, {3} {4}\n", spacing, r1,
-                           convert_mult_op(node.lexeme()), node.children()[0]->lexeme(), cmt);
-            const auto muli_right =
-               fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, convert_mult_op(node.lexeme()),
-                           node.children()[1]->lexeme());
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", muli_left, muli_right, store));
-         }
-         else
-         {
-            const auto load_left =
-               fmt::format("{}lw {}, {}(r0) {}\n", spacing, r1, left_label, cmt);
-            const auto mul_right =
-               fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, convert_mult_op(node.lexeme()),
-                           node.children()[1]->lexeme());
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", load_left, mul_right, store));
-         }
+         code.push_back(
+            {.op = ir::opcode::e_load,
+             .dest = value,
+             .label = fmt::format("{}_{}", m_tables.back()->name(), op.p_symbol->name())});
       }
       else
       {
-         const auto r2 = m_register_pool.pop().value();
-
-         if (is_float_lit(*p_left_symbol) || is_integer_lit(*p_left_symbol))
-         {
-            const auto load_right =
-               fmt::format("{}lw {}, {}(r0) {}\n", spacing, r1, right_label, cmt);
-            const auto muli_left =
-               fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, convert_mult_op(node.lexeme()),
-                           node.children()[0]->lexeme());
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", load_right, muli_left, store));
-         }
-         else
-         {
-            const auto load_left =
-               fmt::format("{}lw {}, {}(r0) {}\n", spacing, r1, left_label, cmt);
-            const auto load_right = fmt::format("{0}lw {1}, {2}(r0)\n", spacing, r2, right_label);
-            const auto mul = fmt::format("{0}{3} {1}, {1}, {2}\n", spacing, r1, r2,
-                                         convert_mult_op(node.lexeme()));
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}{}", load_left, load_right, mul, store));
-         }
-
-         m_register_pool.push(r2);
+         code.push_back(
+            {.op = ir::opcode::e_load_imm, .dest = value, .immediate = std::move(op.literal)});
       }
 
-      m_register_pool.push(r1);
-
-      m_symbols.pop_back();
-      m_symbols.pop_back();
-
-      m_symbols.push_back(&res.val());
+      return value;
    }
-   void code_gen_visitor::visit(const ast::rel_op& node)
+   auto code_gen_visitor::pop_operand() -> operand
    {
-      if (std::size(m_symbols) < 2)
-      {
-         if (!std::empty(m_symbols))
-         {
-            m_symbols.pop_back();
-         }
-
-         return;
-      }
+      assert(!std::empty(m_operands)); // NOLINT
 
-      symbol_table* p_table = m_tables.back();
+      auto op = std::move(m_operands.back());
+      m_operands.pop_back();
 
-      const symbol* p_left_symbol = *(std::end(m_symbols) - 2);
-      const symbol* p_right_symbol = *(std::end(m_symbols) - 1);
-
-      const std::string left_label{fmt::format("{}_{}", p_table->name(), p_left_symbol->name())};
-      const std::string right_label{fmt::format("{}_{}", p_table->name(), p_right_symbol->name())};
-
-      const auto r1 = m_register_pool.pop().value();
-
-      const auto name = fmt::format("temp{}", m_temporary_counter++);
-      const auto res = p_table->insert(name,
-                                       symbol{{.name = name,
-                                               .kind = symbol_type::e_temporary,
-                                               .location = node.location(),
-                                               .size = p_right_symbol->size(),
-                                               .type = std::string{p_right_symbol->type()}}});
+      return op;
+   }
+   auto code_gen_visitor::pop_fragment() -> fragment
+   {
+      assert(!std::empty(m_fragments)); // NOLINT
 
-      const auto temp_label = fmt::format("{}_{}", p_table->name(), res.val().name());
+      auto code = std::move(m_fragments.back());
+      m_fragments.pop_back();
 
-      if (is_float_lit(*p_right_symbol) || is_integer_lit(*p_right_symbol))
-      {
-         if (is_float_lit(*p_left_symbol) || is_integer_lit(*p_left_symbol))
-         {
-            const auto reli_left =
-               fmt::format("{0}{2}i {1}, r0, {3}\n", spacing, r1, convert_rel_op(node.lexeme()),
-                           node.children()[0]->lexeme());
-            const auto reli_right =
-               fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, convert_rel_op(node.lexeme()),
-                           node.children()[1]->lexeme());
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", reli_left, reli_right, store));
-         }
-         else
-         {
-            const auto load_left = fmt::format("{0}lw {1}, {2}(r0)\n", spacing, r1, left_label);
-            const auto rel_right =
-               fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, convert_rel_op(node.lexeme()),
-                           node.children()[1]->lexeme());
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", load_left, rel_right, store));
-         }
-      }
-      else
+      return code;
+   }
+   auto code_gen_visitor::take_function_code() -> fragment
+   {
+      fragment code;
+      for (auto& statement : m_fragments)
       {
-         const auto r2 = m_register_pool.pop().value();
-
-         if (is_float_lit(*p_left_symbol) || is_integer_lit(*p_left_symbol))
-         {
-            const auto load_right = fmt::format("{0}lw {1}, {2}(r0)\n", spacing, r1, right_label);
-            const auto reli_left =
-               fmt::format("{0}{2}i {1}, {1}, {3}\n", spacing, r1, convert_rel_op(node.lexeme()),
-                           node.children()[0]->lexeme());
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}", load_right, reli_left, store));
-         }
-         else
-         {
-            const auto load_left = fmt::format("{0}lw {1}, {2}(r0)\n", spacing, r1, left_label);
-            const auto load_right = fmt::format("{0}lw {1}, {2}(r0)\n", spacing, r2, right_label);
-            const auto rel = fmt::format("{0}{3} {1}, {1}, {2}\n", spacing, r1, r2,
-                                         convert_rel_op(node.lexeme()));
-            const auto label_res =
-               fmt::format("{:<30} {} {}\n", temp_label, "res", res.val().size());
-            const auto store = fmt::format("{0}sw {1}(r0), {2}\n\n", spacing, temp_label, r1);
-
-            m_blocks.push_back(fmt::format("{}{}{}{}", load_left, load_right, rel, store));
-         }
-
-         m_register_pool.push(r2);
+         append(code, std::move(statement));
       }
 
-      m_register_pool.push(r1);
-
-      m_symbols.pop_back();
-      m_symbols.pop_back();
+      m_fragments.clear();
 
-      m_symbols.push_back(&res.val());
+      return code;
    }
 } // namespace munster
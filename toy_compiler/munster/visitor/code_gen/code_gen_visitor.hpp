@@ -2,10 +2,16 @@
 
 #include <toy_compiler/munster/visitor/visitor.hpp>
 
-#include <toy_compiler/munster/visitor/code_gen/register_pool.hpp>
+#include <toy_compiler/munster/ir/program.hpp>
+
+#include <optional>
 
 namespace munster
 {
+   /**
+    * @brief Lowers the AST to the three-address intermediate representation, see
+    * `ir::emit_moon` to write it as Moon code
+    */
    class code_gen_visitor : public visitor<code_gen_visitor>
    {
       friend visitor<code_gen_visitor>;
@@ -13,9 +19,16 @@ namespace munster
    public:
       code_gen_visitor(symbol_table* p_root);
 
-      void place_marker(std::string marker);
+      /**
+       * @brief Mark the start of a statement block, the code of the statements lowered until the
+       * block is visited is joined into the code of the block
+       */
+      void begin_stmt_block();
 
-      auto moon_code() -> std::string_view;
+      /**
+       * @brief Give away the program lowered from the translation unit
+       */
+      auto take_program() -> ir::program;
 
    private:
       void visit(const ast::translation_unit_decl& node);
@@ -66,20 +79,51 @@ namespace munster
       void visit(const ast::rel_op& node);
 
    private:
-      std::string moon_code_output;
-      const std::string spacing{"          "};
+      /**
+       * @brief The code of a statement, or of the statements of a block, laid out as blocks. The
+       * first block falls through from the code before it if it has no label
+       */
+      using fragment = std::vector<ir::basic_block>;
+
+      /**
+       * @brief The value of an expression: a symbol stored in memory, a literal, or the value the
+       * instructions of the expression compute
+       */
+      struct operand
+      {
+         const symbol* p_symbol{nullptr};             // NOLINT
+         std::string literal{};                       // NOLINT
+         std::vector<ir::instruction> code{};         // NOLINT
+         std::optional<ir::virtual_register> value{}; // NOLINT
+      };
+
+      void handle_binary_op(ir::opcode op);
+
+      /**
+       * @brief Move the instructions computing `op` at the end of `code` and give back the
+       * register holding it, loading it first if it is in memory
+       */
+      auto take_value(operand&& op, std::vector<ir::instruction>& code) -> ir::virtual_register;
+      auto pop_operand() -> operand;
+      auto pop_fragment() -> fragment;
+
+      /**
+       * @brief Join the code of every statement lowered since the start of the function
+       */
+      auto take_function_code() -> fragment;
+
+   private:
+      ir::program m_program;
 
-      std::int64_t m_literal_counter = 0;
-      std::int64_t m_temporary_counter = 0;
       std::int64_t m_if_counter = 0;
       std::int64_t m_function_counter = 0;
+      std::uint32_t m_value_counter = 0;
 
       symbol_table* mp_root{};
 
       std::vector<symbol_table*> m_tables;
-      std::vector<symbol*> m_symbols;
-      std::vector<std::string> m_blocks;
-
-      register_pool m_register_pool;
+      std::vector<operand> m_operands;
+      std::vector<fragment> m_fragments;
+      std::vector<std::size_t> m_stmt_block_starts;
    };
 } // namespace munster
@@ -0,0 +1,209 @@
+/**
+ * @brief Runs tests on functions defined in code_gen_visitor.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ir/moon_emitter.hpp>
+#include <toy_compiler/munster/lexer.hpp>
+#include <toy_compiler/munster/parser.hpp>
+#include <toy_compiler/munster/visitor/code_gen/code_gen_visitor.hpp>
+#include <toy_compiler/munster/visitor/symbol_table/memory_size_visitor.hpp>
+#include <toy_compiler/munster/visitor/symbol_table/symbol_table_visitor.hpp>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace munster;
+
+namespace
+{
+   // the loops & the arithmetic of bubblesort.src, on variables instead of arrays
+   constexpr std::string_view source = R"(
+main
+{
+  var
+  {
+    integer n;
+    integer i;
+    integer total;
+  }
+  n = 7;
+  i = 0;
+  total = 0;
+  while (i < n - 1) {
+    if (total > 10)
+      then {
+        total = total - 10;
+      } else {
+        total = total + i * 2;
+      };
+    i = i + 1;
+  };
+}
+)";
+
+   /**
+    * @brief Build the symbol tables of the source, size them, then lower it to the IR
+    */
+   auto lower() -> ir::program
+   {
+      const auto tokens = make_token_stream(source);
+      REQUIRE(tokens);
+
+      const auto result = parse_tokens(tokens.value());
+      REQUIRE(result.value == parse_status::success);
+
+      ast::visitor_variant tables{symbol_table_visitor{}};
+      result.ast->accept(tables);
+
+      auto* p_root = std::get<symbol_table_visitor>(tables).get_root_table();
+
+      ast::visitor_variant sizes{memory_size_visitor{p_root}};
+      result.ast->accept(sizes);
+
+      ast::visitor_variant code_gen{code_gen_visitor{p_root}};
+      result.ast->accept(code_gen);
+
+      return std::get<code_gen_visitor>(code_gen).take_program();
+   }
+
+   /**
+    * @brief The instruction of the block writing `reg`, registers are only read in the block
+    * writing them
+    */
+   auto find_writer(const ir::basic_block& block, ir::virtual_register reg)
+      -> const ir::instruction*
+   {
+      const auto it = std::ranges::find_if(block.instructions, [&](const ir::instruction& instr) {
+         return ir::writes_dest(instr) && instr.dest == reg;
+      });
+
+      return it != std::end(block.instructions) ? &(*it) : nullptr;
+   }
+
+   auto has_instruction(const ir::function& func, ir::opcode op, std::string_view immediate)
+      -> bool
+   {
+      return std::ranges::any_of(func.blocks, [&](const ir::basic_block& block) {
+         return std::ranges::any_of(block.instructions, [&](const ir::instruction& instr) {
+            return instr.op == op && instr.immediate == immediate;
+         });
+      });
+   }
+} // namespace
+
+TEST_SUITE("Code generation visitor test suite")
+{
+   TEST_CASE("if, while & arithmetic")
+   {
+      const auto program = lower();
+
+      REQUIRE(std::size(program.functions) == 1);
+      const auto& main_func = program.functions.front();
+      CHECK(main_func.kind == ir::function_kind::e_main);
+
+      SUBCASE("branches test the register holding their condition")
+      {
+         std::vector<const ir::instruction*> while_conditions;
+         std::vector<const ir::instruction*> if_conditions;
+         for (const auto& block : main_func.blocks)
+         {
+            for (const auto& instr : block.instructions)
+            {
+               if (instr.op == ir::opcode::e_branch_zero)
+               {
+                  const auto* p_condition = find_writer(block, instr.lhs);
+                  REQUIRE(p_condition);
+
+                  auto& conditions =
+                     instr.label.starts_with("wh_end_") ? while_conditions : if_conditions;
+                  conditions.push_back(p_condition);
+               }
+            }
+         }
+
+         REQUIRE(std::size(while_conditions) == 1);
+         CHECK(while_conditions.front()->op == ir::opcode::e_lt);
+         CHECK(std::empty(while_conditions.front()->immediate));
+
+         REQUIRE(std::size(if_conditions) == 1);
+         CHECK(if_conditions.front()->op == ir::opcode::e_gt);
+         CHECK(if_conditions.front()->immediate == "10");
+
+         // the loop goes back to the block testing its condition
+         const auto loop_begin = std::ranges::find_if(main_func.blocks, [](const auto& block) {
+            return block.label.starts_with("wh_beg_");
+         });
+         REQUIRE(loop_begin != std::end(main_func.blocks));
+         CHECK(std::ranges::any_of(main_func.blocks, [&](const ir::basic_block& block) {
+            return !std::empty(block.instructions) &&
+               block.instructions.back().op == ir::opcode::e_jump &&
+               block.instructions.back().label == loop_begin->label;
+         }));
+      }
+      SUBCASE("literals on the right of an operator are immediate operands")
+      {
+         CHECK(has_instruction(main_func, ir::opcode::e_sub, "1"));
+         CHECK(has_instruction(main_func, ir::opcode::e_sub, "10"));
+         CHECK(has_instruction(main_func, ir::opcode::e_mul, "2"));
+         CHECK(has_instruction(main_func, ir::opcode::e_add, "1"));
+         CHECK(has_instruction(main_func, ir::opcode::e_gt, "10"));
+      }
+      SUBCASE("assignments store the value of their expression")
+      {
+         std::vector<std::string> stored;
+         for (const auto& block : main_func.blocks)
+         {
+            for (const auto& instr : block.instructions)
+            {
+               if (instr.op == ir::opcode::e_store)
+               {
+                  const auto* p_value = find_writer(block, instr.lhs);
+                  REQUIRE(p_value);
+
+                  if (instr.label == "main_n")
+                  {
+                     CHECK(p_value->op == ir::opcode::e_load_imm);
+                     CHECK(p_value->immediate == "7");
+                  }
+
+                  stored.push_back(instr.label);
+               }
+            }
+         }
+
+         std::ranges::sort(stored);
+         CHECK(stored == std::vector<std::string>{"main_i", "main_i", "main_n", "main_total",
+                                                  "main_total", "main_total"});
+      }
+      SUBCASE("moon code")
+      {
+         const auto moon = ir::emit_moon(program);
+
+         CHECK(moon.find("bz r") != std::string::npos);
+         CHECK(moon.find("cgti r") != std::string::npos);
+         CHECK(moon.find("subi r") != std::string::npos);
+         CHECK(moon.find("muli r") != std::string::npos);
+         CHECK(moon.find("sw main_total(r0), r") != std::string::npos);
+         CHECK(moon.find("main_total                     res 4") != std::string::npos);
+      }
+   }
+}
@@ -0,0 +1,141 @@
+#include <toy_compiler/munster/visitor/pass_manager.hpp>
+
+#include <range/v3/algorithm/all_of.hpp>
+#include <range/v3/algorithm/any_of.hpp>
+#include <range/v3/algorithm/find.hpp>
+
+namespace munster
+{
+   auto pass_manager::add(pass new_pass) -> pass_manager&
+   {
+      m_passes.push_back(std::move(new_pass));
+
+      return *this;
+   }
+
+   auto pass_manager::schedule() const -> monad::maybe<std::vector<pass_group>>
+   {
+      constexpr std::size_t unscheduled = std::numeric_limits<std::size_t>::max();
+
+      // the traversal each pass is scheduled in
+      std::vector<std::size_t> traversals(std::size(m_passes), unscheduled);
+      std::vector<std::vector<std::size_t>> dependencies(std::size(m_passes));
+      for (std::size_t i = 0; i < std::size(m_passes); ++i)
+      {
+         for (const auto& name : m_passes[i].dependencies)
+         {
+            const auto index = find_pass(name);
+            if (!index)
+            {
+               return monad::none;
+            }
+
+            dependencies[i].push_back(index.value());
+         }
+      }
+
+      std::vector<pass_group> groups;
+      std::size_t scheduled = 0;
+      while (scheduled != std::size(m_passes))
+      {
+         const std::size_t current = std::size(groups);
+         const auto is_done = [&](std::size_t dependency) {
+            return traversals[dependency] < current;
+         };
+
+         pass_group group;
+         for (std::size_t i = 0; i < std::size(m_passes); ++i)
+         {
+            if (traversals[i] == unscheduled && ranges::all_of(dependencies[i], is_done))
+            {
+               group.push_back(i);
+            }
+         }
+
+         if (std::empty(group))
+         {
+            return monad::none; // the remaining passes depend on each other
+         }
+
+         for (std::size_t i : group)
+         {
+            traversals[i] = current;
+         }
+
+         scheduled += std::size(group);
+         groups.push_back(std::move(group));
+      }
+
+      return groups;
+   }
+
+   auto pass_manager::run(const ast::node& root) -> monad::maybe<std::size_t>
+   {
+      const auto groups = schedule();
+      if (!groups)
+      {
+         return monad::none;
+      }
+
+      std::vector<bool> skipped(std::size(m_passes), false);
+      const auto is_skipped = [&](const std::string& name) {
+         return skipped[find_pass(name).value()];
+      };
+
+      std::size_t traversal_count = 0;
+      for (const auto& group : groups.value())
+      {
+         pass_group members;
+         std::vector<ast::visitor_variant> visitors;
+         for (std::size_t i : group)
+         {
+            if (ranges::any_of(m_passes[i].dependencies, is_skipped))
+            {
+               skipped[i] = true;
+               continue;
+            }
+
+            auto visitor = m_passes[i].make();
+            if (!visitor)
+            {
+               skipped[i] = true;
+               continue;
+            }
+
+            members.push_back(i);
+            visitors.push_back(std::move(visitor.value()));
+         }
+
+         if (std::empty(visitors))
+         {
+            continue;
+         }
+
+         root.accept(ast::visitor_group{visitors});
+         ++traversal_count;
+
+         for (std::size_t j = 0; j < std::size(members); ++j)
+         {
+            if (const auto& finish = m_passes[members[j]].finish)
+            {
+               finish(visitors[j]);
+            }
+         }
+
+         m_visitors.push_back(std::move(visitors));
+      }
+
+      return traversal_count;
+   }
+
+   auto pass_manager::find_pass(std::string_view name) const -> monad::maybe<std::size_t>
+   {
+      const auto it = ranges::find(m_passes, name, &pass::name);
+      if (it == std::end(m_passes))
+      {
+         return monad::none;
+      }
+
+      return static_cast<std::size_t>(std::distance(std::begin(m_passes), it));
+   }
+} // namespace munster
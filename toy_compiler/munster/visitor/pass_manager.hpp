@@ -0,0 +1,78 @@
+#pragma once
+
+#include <toy_compiler/munster/ast/node.hpp>
+
+#include <monads/maybe.hpp>
+
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace munster
+{
+   /**
+    * @brief A visitor run over the whole AST, along with the passes whose results it needs
+    */
+   struct pass
+   {
+      std::string name;                      // NOLINT
+      std::vector<std::string> dependencies; // NOLINT
+
+      /**
+       * @brief Build the visitor of the pass, called once every dependency of the pass is done.
+       * Giving back nothing skips the pass along with the passes depending on it
+       */
+      std::function<monad::maybe<ast::visitor_variant>()> make; // NOLINT
+      /**
+       * @brief Collect the results of the pass, called once the traversal it was part of is done
+       */
+      std::function<void(ast::visitor_variant&)> finish = nullptr; // NOLINT
+   };
+
+   /**
+    * @brief The indices of the passes that are run together in a single traversal of the AST
+    */
+   using pass_group = std::vector<std::size_t>;
+
+   /**
+    * @brief Schedule the passes run over the AST so that passes which do not depend on each other
+    * share a single traversal of the tree instead of walking it once each.
+    *
+    * A pass is grouped with the earliest traversal following the ones of all of its dependencies.
+    * Within a traversal, every node is visited by each pass of the group in the order the passes
+    * were added. Passes must declare every pass they read the results of, two passes without a
+    * dependency between them may see each other's effects on a node.
+    */
+   class pass_manager
+   {
+   public:
+      /**
+       * @brief Add a pass to run, its dependencies must be added before `run` is called
+       */
+      auto add(pass new_pass) -> pass_manager&;
+
+      /**
+       * @brief Compute the traversals needed to run every pass. Gives back nothing if a pass
+       * depends on an unknown pass or if the dependencies form a cycle
+       */
+      [[nodiscard]] auto schedule() const -> monad::maybe<std::vector<pass_group>>;
+
+      /**
+       * @brief Run every pass over the AST rooted at `root`
+       *
+       * @return The number of traversals of the AST done, nothing if the passes cannot be
+       * scheduled
+       */
+      auto run(const ast::node& root) -> monad::maybe<std::size_t>;
+
+   private:
+      [[nodiscard]] auto find_pass(std::string_view name) const -> monad::maybe<std::size_t>;
+
+   private:
+      std::vector<pass> m_passes;
+
+      // the visitors are kept alive as other passes may point into their results
+      std::vector<std::vector<ast::visitor_variant>> m_visitors;
+   };
+} // namespace munster
@@ -0,0 +1,139 @@
+/**
+ * @brief Runs tests on functions defined in pass_manager.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/ast/decl/id_decl.hpp>
+#include <toy_compiler/munster/visitor/pass_manager.hpp>
+
+#include <string>
+#include <vector>
+
+using munster::pass;
+using munster::pass_group;
+using munster::pass_manager;
+
+/**
+ * @brief A pass that must never be built
+ */
+auto make_pass(std::string name, std::vector<std::string> dependencies = {}) -> pass
+{
+   return {.name = std::move(name),
+           .dependencies = std::move(dependencies),
+           .make = [] {
+              FAIL("pass should not be built");
+              return monad::maybe<munster::ast::visitor_variant>{};
+           }};
+}
+
+TEST_SUITE("Pass manager test suite")
+{
+   TEST_CASE("schedule")
+   {
+      SUBCASE("no passes")
+      {
+         const auto groups = pass_manager{}.schedule();
+
+         REQUIRE(groups);
+         CHECK(std::empty(groups.value()));
+      }
+      SUBCASE("independent passes share a traversal")
+      {
+         pass_manager passes;
+         passes.add(make_pass("a")).add(make_pass("b")).add(make_pass("c"));
+
+         const auto groups = passes.schedule();
+
+         REQUIRE(groups);
+         CHECK(groups.value() == std::vector<pass_group>{{0, 1, 2}});
+      }
+      SUBCASE("a chain of dependencies needs a traversal per pass")
+      {
+         pass_manager passes;
+         passes.add(make_pass("a")).add(make_pass("b", {"a"})).add(make_pass("c", {"b"}));
+
+         const auto groups = passes.schedule();
+
+         REQUIRE(groups);
+         CHECK(groups.value() == std::vector<pass_group>{{0}, {1}, {2}});
+      }
+      SUBCASE("passes are run as early as their dependencies allow")
+      {
+         pass_manager passes;
+         passes.add(make_pass("c", {"a", "b"}))
+            .add(make_pass("a"))
+            .add(make_pass("d", {"a"}))
+            .add(make_pass("b", {"a"}))
+            .add(make_pass("e"));
+
+         const auto groups = passes.schedule();
+
+         REQUIRE(groups);
+         CHECK(groups.value() == std::vector<pass_group>{{1, 4}, {2, 3}, {0}});
+      }
+      SUBCASE("unknown dependency")
+      {
+         pass_manager passes;
+         passes.add(make_pass("a", {"b"}));
+
+         CHECK_FALSE(passes.schedule());
+      }
+      SUBCASE("cyclic dependencies")
+      {
+         pass_manager passes;
+         passes.add(make_pass("a")).add(make_pass("b", {"c"})).add(make_pass("c", {"b"}));
+
+         CHECK_FALSE(passes.schedule());
+      }
+   }
+   TEST_CASE("run")
+   {
+      munster::ast::arena arena;
+      const auto root = arena.make<munster::ast::id_decl>("x", munster::source_location{});
+
+      SUBCASE("passes that cannot be scheduled are not run")
+      {
+         pass_manager passes;
+         passes.add(make_pass("a", {"a"}));
+
+         CHECK_FALSE(passes.run(*root));
+      }
+      SUBCASE("passes depending on a skipped pass are skipped")
+      {
+         std::vector<std::string> built;
+
+         pass_manager passes;
+         passes
+            .add({.name = "a",
+                  .dependencies = {},
+                  .make = [&]() -> monad::maybe<munster::ast::visitor_variant> {
+                     built.emplace_back("a");
+                     return monad::none;
+                  }})
+            .add(make_pass("b", {"a"}))
+            .add(make_pass("c", {"b"}));
+
+         const auto traversals = passes.run(*root);
+
+         REQUIRE(traversals);
+         CHECK(traversals.value() == 0);
+         CHECK(built == std::vector<std::string>{"a"});
+      }
+   }
+}
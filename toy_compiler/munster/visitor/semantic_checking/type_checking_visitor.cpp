@@ -6,6 +6,7 @@
 #include <toy_compiler/munster/ast/decl/main_decl.hpp>
 #include <toy_compiler/munster/ast/decl/member_func_decl.hpp>
 #include <toy_compiler/munster/ast/decl/member_var_decl.hpp>
+#include <toy_compiler/munster/ast/decl/translation_unit_decl.hpp>
 #include <toy_compiler/munster/ast/decl/variable_decl.hpp>
 #include <toy_compiler/munster/ast/expr/float_expr.hpp>
 #include <toy_compiler/munster/ast/expr/func_expr.hpp>
@@ -19,6 +20,7 @@
 #include <toy_compiler/munster/ast/op/rel_op.hpp>
 #include <toy_compiler/munster/ast/stmt/assign_stmt.hpp>
 #include <toy_compiler/munster/ast/stmt/func_stmt.hpp>
+#include <toy_compiler/util/parallel_for.hpp>
 
 #include <range/v3/action/split.hpp>
 #include <range/v3/algorithm/count_if.hpp>
@@ -38,15 +40,40 @@ using namespace mpark::patterns;
 
 namespace munster
 {
-   template <typename Any>
-   auto to(const ast::node_ptr& node) -> Any*
+   type_checking_visitor::type_checking_visitor(symbol_table* p_root, std::size_t thread_count) :
+      mp_root{p_root},
+      m_thread_count{thread_count}
+   {}
+
+   void type_checking_visitor::visit(const ast::translation_unit_decl& /*tud*/)
    {
-      return dynamic_cast<Any*>(node.get());
-   }
+      if (std::empty(m_deferred_funcs))
+      {
+         return;
+      }
+
+      // each function is walked by its own checker, the errors are merged once every function is
+      // checked and put back where the walk would have reported them
+      std::vector<std::vector<parse_error>> errors(std::size(m_deferred_funcs));
+      util::parallel_for(std::size(m_deferred_funcs), m_thread_count, [&](std::size_t i) {
+         ast::visitor_variant checker{type_checking_visitor{mp_root}};
+         m_deferred_funcs[i]->accept(checker);
+         errors[i] = std::move(std::get<type_checking_visitor>(checker).m_errors);
+      });
 
-   type_checking_visitor::type_checking_visitor(symbol_table* p_root) : mp_root{p_root} {}
+      std::vector<parse_error> merged;
+      for (auto& func_errors : errors)
+      {
+         merged.insert(std::end(merged), std::make_move_iterator(std::begin(func_errors)),
+                       std::make_move_iterator(std::end(func_errors)));
+      }
+
+      const auto at = std::begin(m_errors) + static_cast<std::ptrdiff_t>(m_deferred_errors_at);
+      m_errors.insert(at, std::make_move_iterator(std::begin(merged)),
+                      std::make_move_iterator(std::end(merged)));
 
-   void type_checking_visitor::visit(const ast::translation_unit_decl& /*tud*/) {}
+      m_deferred_funcs.clear();
+   }
    void type_checking_visitor::visit(const ast::compound_class_decl& /*ccd*/) {}
    void type_checking_visitor::visit(const ast::class_decl& /*cd*/) {}
    void type_checking_visitor::visit(const ast::compound_inheritance_decl&) {}
@@ -57,18 +84,33 @@ namespace munster
    void type_checking_visitor::visit(const ast::compound_function_decl& /*cfd*/) {}
    void type_checking_visitor::visit(const ast::func_decl& func_d)
    {
-      const auto* head = to<ast::func_head_decl>(func_d.children()[0]);
-      const auto* body = to<ast::func_body_decl>(func_d.children()[1]);
+      if (m_thread_count <= 1)
+      {
+         check_function(func_d);
+
+         return;
+      }
+
+      // the functions are next to each other, so their errors all go in at the same place
+      if (std::empty(m_deferred_funcs))
+      {
+         m_deferred_errors_at = std::size(m_errors);
+      }
+
+      m_deferred_funcs.push_back(&func_d);
+      m_in_deferred_func = false;
+   }
+   void type_checking_visitor::check_function(const ast::func_decl& func_d)
+   {
+      const auto* head = ast::dyn_cast<ast::func_head_decl>(func_d.children()[0]);
+      const auto* body = ast::dyn_cast<ast::func_body_decl>(func_d.children()[1]);
 
-      std::string function_name;
       std::string class_name;
       if (head->class_name())
       {
-         function_name = std::string{head->class_name().value()};
          class_name = std::string{head->lexeme()};
 
-         const auto key = fmt::format("{} '{} ({})'", function_name, head->return_type(),
-                                      fmt::join(head->params(), ", "));
+         const auto key = head->signature();
 
          symbol_table* class_table = nullptr;
          if (auto class_res = mp_root->lookup(class_name))
@@ -76,29 +118,36 @@ namespace munster
             class_table = class_res.val().link();
             if (class_table)
             {
-               if (auto func_res = class_table->lookup(key))
+               auto func_res = class_table->lookup(key);
+               if (func_res && func_res.val().link())
                {
-                  symbol_table* function_table = func_res.val().link();
-                  std::vector<symbol_table*> tables = {class_table, function_table};
-                  check_function_decl(body, tables);
+                  check_function_decl(body, func_res.val().link());
                }
             }
          }
       }
       else
       {
-         const auto key = fmt::format("{} '{} ({})'", head->lexeme(), head->return_type(),
-                                      fmt::join(head->params(), ", "));
+         const auto key = head->signature();
 
          if (auto func_res = mp_root->lookup(key))
          {
-            std::vector<symbol_table*> tables{func_res.val().link()};
-            check_function_decl(body, tables);
+            check_function_decl(body, func_res.val().link());
          }
       }
    }
    void type_checking_visitor::visit(const ast::func_head_decl& head)
    {
+      // the head is visited before the body, whose nodes are left to the checker of the function
+      if (m_thread_count > 1)
+      {
+         m_in_deferred_func = true;
+
+         return;
+      }
+
+      m_temporary_counter = 0;
+
       if (head.class_name())
       {
          const auto class_name = std::string{head.lexeme()};
@@ -110,8 +159,7 @@ namespace munster
             {
                m_tables.push_back(class_table);
 
-               const auto func_key = fmt::format("{} '{} ({})'", func_name, head.return_type(),
-                                                 fmt::join(head.params(), ", "));
+               const auto func_key = head.signature();
 
                if (auto func_res = class_table->lookup(func_key))
                {
@@ -136,8 +184,7 @@ namespace munster
       }
       else
       {
-         const auto func_key = fmt::format("{} '{} ({})'", head.lexeme(), head.return_type(),
-                                           fmt::join(head.params(), ", "));
+         const auto func_key = head.signature();
 
          if (auto func_res = mp_root->lookup(func_key))
          {
@@ -147,6 +194,11 @@ namespace munster
    }
    void type_checking_visitor::visit(const ast::func_body_decl& /*body*/)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       if (!std::empty(m_tables))
       {
          m_tables.pop_back();
@@ -169,61 +221,46 @@ namespace munster
 
    void type_checking_visitor::visit(const ast::func_expr& /*node*/)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       m_symbols.push_back(nullptr);
    }
    void type_checking_visitor::visit(const ast::var_expr& node)
    {
-      const std::string var_name{node.lexeme()};
-
-      if (std::size(m_tables) == 1u)
+      if (m_in_deferred_func)
       {
-         symbol_table* func_table = *(std::end(m_tables) - 1);
-
-         if (const auto res = func_table->lookup(var_name))
-         {
-            m_symbols.push_back(&res.val());
-         }
-         else
-         {
-            m_symbols.push_back({});
-            m_errors.push_back(
-               parse_error{.type = parse_error_type::e_semantic_error,
-                           .pos = node.location(),
-                           .lexeme = fmt::format("undeclared variable '{}'", var_name)});
-         }
+         return;
       }
-      else if (std::size(m_tables) == 2u)
-      {
-         symbol_table* p_func_table = *(std::end(m_tables) - 1);
-         symbol_table* p_class_table = *(std::end(m_tables) - 2);
-
-         symbol* p_symbol = nullptr;
-         if (const auto res = p_func_table->lookup(var_name))
-         {
-            p_symbol = &res.val();
-         }
 
-         if (!p_symbol)
-         {
-            if (const auto res = p_class_table->lookup(var_name))
-            {
-               p_symbol = &res.val();
-            }
-         }
+      const auto var_name = node.lexeme();
 
-         if (!p_symbol)
-         {
-            m_errors.push_back(
-               parse_error{.type = parse_error_type::e_semantic_error,
-                           .pos = node.location(),
-                           .lexeme = fmt::format("undeclared variable '{}'", var_name)});
-         }
+      if (std::empty(m_tables))
+      {
+         return;
+      }
 
-         m_symbols.push_back(p_symbol);
+      // member function tables have their class as parent, so this also finds the members
+      symbol* p_symbol = m_tables.back()->resolve(node.lexeme_id());
+      if (!p_symbol)
+      {
+         m_errors.push_back(
+            parse_error{.type = parse_error_type::e_semantic_error,
+                        .pos = node.location(),
+                        .lexeme = fmt::format("undeclared variable '{}'", var_name)});
       }
+
+      m_symbols.push_back(p_symbol);
    }
    void type_checking_visitor::visit(const ast::float_expr& node)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       auto* func_table = m_tables.back();
 
       const auto name = fmt::format("temp{}", m_temporary_counter++);
@@ -237,6 +274,11 @@ namespace munster
    }
    void type_checking_visitor::visit(const ast::integer_expr& node)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       auto* func_table = m_tables.back();
 
       const auto name = fmt::format("temp{}", m_temporary_counter++);
@@ -250,6 +292,11 @@ namespace munster
    }
    void type_checking_visitor::visit(const ast::string_expr& node)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       auto* func_table = m_tables.back();
 
       const auto name = fmt::format("temp{}", m_temporary_counter++);
@@ -275,6 +322,11 @@ namespace munster
 
    void type_checking_visitor::visit(const ast::dot_op& node)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       auto* p_left_symbol = *(std::end(m_symbols) - 2);
       auto* p_right_symbol = *(std::end(m_symbols) - 1);
 
@@ -322,6 +374,11 @@ namespace munster
    }
    void type_checking_visitor::visit(const ast::assign_op& node)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       // TODO: remove
       if (std::size(m_symbols) != 2)
       {
@@ -382,6 +439,11 @@ namespace munster
    }
    void type_checking_visitor::visit(const ast::add_op& node)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       symbol_table* p_func_table = m_tables.back();
 
       const symbol* p_left_symbol = *(std::end(m_symbols) - 2);
@@ -444,6 +506,11 @@ namespace munster
    }
    void type_checking_visitor::visit(const ast::mult_op& node)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       symbol_table* p_func_table = m_tables.back();
 
       const symbol* p_left_symbol = *(std::end(m_symbols) - 2);
@@ -506,6 +573,11 @@ namespace munster
    }
    void type_checking_visitor::visit(const ast::rel_op& node)
    {
+      if (m_in_deferred_func)
+      {
+         return;
+      }
+
       symbol_table* p_func_table = m_tables.back();
 
       const symbol* p_left_symbol = *(std::end(m_symbols) - 2);
@@ -589,7 +661,7 @@ namespace munster
    //
 
    void type_checking_visitor::check_function_decl(const ast::func_body_decl* body,
-                                                   std::span<symbol_table*> tables)
+                                                   symbol_table* p_scope)
    {
       if (std::size(body->children()) == 1)
       {
@@ -600,16 +672,16 @@ namespace munster
 
          for (const auto& stmt : compound_statement->children())
          {
-            if (const auto func_or_assign = to<ast::func_stmt>(stmt))
+            if (const auto func_or_assign = ast::dyn_cast<ast::func_stmt>(stmt))
             {
                const auto& func_or_assign_child = func_or_assign->children()[0];
 
-               if (const auto assign = to<ast::assign_op>(func_or_assign_child))
+               if (const auto assign = ast::dyn_cast<ast::assign_op>(func_or_assign_child))
                {
-                  handle_assign_op(assign, tables);
+                  handle_assign_op(assign, p_scope);
                }
 
-               if (const auto func = to<ast::func_expr>(func_or_assign_child))
+               if (const auto func = ast::dyn_cast<ast::func_expr>(func_or_assign_child))
                {
                   handle_function_expr(func);
                }
@@ -619,38 +691,28 @@ namespace munster
    }
 
    void type_checking_visitor::handle_assign_op(const ast::assign_op* assign,
-                                                std::span<symbol_table*> tables)
+                                                symbol_table* p_scope)
    {
       const auto& left = assign->children()[0];
       [[maybe_unused]] const auto& right = assign->children()[1];
 
       std::string left_type;
-      if (const auto* var = to<ast::var_expr>(left)) // valid
+      if (const auto* var = ast::dyn_cast<ast::var_expr>(left)) // valid
       {
-         handle_var_expr(var, tables);
+         handle_var_expr(var, p_scope);
       }
 
-      if (const auto* dot = to<ast::dot_op>(left))
+      if (const auto* dot = ast::dyn_cast<ast::dot_op>(left))
       {
-         handle_dot_operator(dot, tables);
+         handle_dot_operator(dot, p_scope);
       }
    }
 
    auto type_checking_visitor::handle_var_expr(const ast::var_expr* var_expr,
-                                               std::span<symbol_table*> tables) -> std::string_view
+                                               symbol_table* p_scope) -> std::string_view
    {
-      const std::string var_name{var_expr->lexeme()};
-
-      // clang-format off
-      const auto symbols = tables
-         | vi::filter([&](symbol_table* table) { return table->lookup(var_name); })
-         | vi::transform([&](symbol_table* table) -> symbol* {
-               return &table->lookup(var_name).val();
-           })
-         | ranges::to<std::vector>;
-      // clang-format on
-
-      if (std::empty(symbols))
+      const auto* p_symbol = p_scope->resolve(var_expr->lexeme_id());
+      if (!p_symbol)
       {
          m_errors.push_back(
             {.type = parse_error_type::e_semantic_error,
@@ -661,7 +723,7 @@ namespace munster
       }
       else
       {
-         return symbols.back()->type();
+         return p_symbol->type();
       }
 
       // TODO: Check for overshadow
@@ -693,19 +755,19 @@ namespace munster
    }
 
    auto type_checking_visitor::handle_dot_operator(const ast::dot_op* dot,
-                                                   std::span<symbol_table*> tables)
+                                                   symbol_table* p_scope)
       -> std::string_view
    {
       const auto& left = dot->children()[0];
       const auto& right = dot->children()[1];
 
-      if (const auto* func = to<ast::func_expr>(left))
+      if (const auto* func = ast::dyn_cast<ast::func_expr>(left))
       {
       }
 
-      if (const auto* var = to<ast::var_expr>(left))
+      if (const auto* var = ast::dyn_cast<ast::var_expr>(left))
       {
-         const auto return_type = handle_var_expr(var, tables);
+         const auto return_type = handle_var_expr(var, p_scope);
 
          if (const auto res = mp_root->lookup(std::string{return_type}))
          {
@@ -728,18 +790,18 @@ namespace munster
          }
       }
 
-      if (const auto* dot_operator = to<ast::dot_op>(left))
+      if (const auto* dot_operator = ast::dyn_cast<ast::dot_op>(left))
       {
-         return handle_dot_operator(dot_operator, tables);
+         return handle_dot_operator(dot_operator, p_scope);
       }
 
-      if (const auto* func = to<ast::func_expr>(right))
+      if (const auto* func = ast::dyn_cast<ast::func_expr>(right))
       {
       }
 
-      if (const auto* var = to<ast::var_expr>(right))
+      if (const auto* var = ast::dyn_cast<ast::var_expr>(right))
       {
-         return handle_var_expr(var, tables);
+         return handle_var_expr(var, p_scope);
       }
 
       return {};
@@ -810,7 +872,7 @@ namespace munster
       [[maybe_unused]] const auto& right = dot->children()[1];
 
       // Path only taken for free functions
-      if (const auto* func = to<ast::func_expr>(left))
+      if (const auto* func = ast::dyn_cast<ast::func_expr>(left))
       {
          const auto return_type = handle_function_expr(func);
 
@@ -820,12 +882,12 @@ namespace munster
          }
       }
 
-      if (const auto* var = to<ast::var_expr>(left))
+      if (const auto* var = ast::dyn_cast<ast::var_expr>(left))
       {
          // const auto var_name = var_expr->lexeme();
       }
 
-      if (const auto* dot_operator = to<ast::dot_op>(left))
+      if (const auto* dot_operator = ast::dyn_cast<ast::dot_op>(left))
       {
          handle_dot_operator(dot_operator);
       }
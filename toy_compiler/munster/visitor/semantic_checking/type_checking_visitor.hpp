@@ -12,7 +12,18 @@ namespace munster
       friend visitor<type_checking_visitor>;
 
    public:
-      type_checking_visitor(symbol_table* p_root);
+      /**
+       * @brief The functions are checked once the whole translation unit was visited, each one
+       * walked by its own checker and spread over `thread_count` threads, instead of as each
+       * function is visited when `thread_count` is more than 1. Errors are reported in the same
+       * order either way
+       */
+      type_checking_visitor(symbol_table* p_root, std::size_t thread_count = 1);
+
+      /**
+       * @brief Check the body of a function against the symbol tables
+       */
+      void check_function(const ast::func_decl& func_d);
 
       void visit(const ast::translation_unit_decl&);
 
@@ -65,22 +76,28 @@ namespace munster
       auto get_variable_type(const symbol* p_symbol) const -> std::string;
       auto is_type_error(const symbol* p_symbol) const -> bool;
 
-      void check_function_decl(const ast::func_body_decl*, std::span<symbol_table*> tables);
+      void check_function_decl(const ast::func_body_decl*, symbol_table* p_scope);
 
-      void handle_assign_op(const ast::assign_op* assign, std::span<symbol_table*> tables);
-      auto handle_var_expr(const ast::var_expr* var_expr, std::span<symbol_table*> tables)
+      void handle_assign_op(const ast::assign_op* assign, symbol_table* p_scope);
+      auto handle_var_expr(const ast::var_expr* var_expr, symbol_table* p_scope)
          -> std::string_view;
-      auto handle_dot_operator(const ast::dot_op* dot, std::span<symbol_table*> tables)
+      auto handle_dot_operator(const ast::dot_op* dot, symbol_table* p_scope)
          -> std::string_view;
-      auto handle_func_expr(const ast::func_expr* func_expr, std::span<symbol_table*> tables);
+      auto handle_func_expr(const ast::func_expr* func_expr, symbol_table* p_scope);
 
       auto handle_function_expr(const ast::func_expr*) -> std::string;
       auto handle_dot_operator(const ast::dot_op*) -> std::string;
 
    private:
-      inline static std::int64_t m_temporary_counter = 0; // NOLINT
+      // temporaries are numbered from 0 in each function, whichever thread checks it
+      std::int64_t m_temporary_counter = 0;
 
       symbol_table* mp_root{};
+      std::size_t m_thread_count{1};
+
+      std::vector<const ast::func_decl*> m_deferred_funcs;
+      std::size_t m_deferred_errors_at{0};
+      bool m_in_deferred_func{false};
 
       std::vector<symbol_table*> m_tables;
       std::vector<symbol*> m_symbols;
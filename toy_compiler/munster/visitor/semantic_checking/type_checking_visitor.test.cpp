@@ -0,0 +1,121 @@
+/**
+ * @brief Runs tests on functions defined in type_checking_visitor.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/lexer.hpp>
+#include <toy_compiler/munster/parser.hpp>
+#include <toy_compiler/munster/visitor/semantic_checking/type_checking_visitor.hpp>
+#include <toy_compiler/munster/visitor/symbol_table/symbol_table_visitor.hpp>
+
+#include <string_view>
+#include <vector>
+
+using namespace munster;
+
+namespace
+{
+   constexpr std::string_view source = R"(
+func first(integer a) : integer
+{
+  var
+  {
+    integer b;
+  }
+  b = a;
+  c = a;
+  return (b);
+}
+
+func second(float a) : float
+{
+  var
+  {
+    float b;
+  }
+  d = a;
+  b = 1.5 + 2;
+  return (b);
+}
+
+func third(integer a) : integer
+{
+  var
+  {
+    integer b;
+  }
+  e = b;
+  f = a;
+  return (b);
+}
+
+main
+{
+  var
+  {
+    integer x;
+  }
+  x = 1;
+  g = x;
+}
+)";
+
+   /**
+    * @brief Build the symbol tables of the source then type check it with `thread_count` threads
+    */
+   auto type_check(std::size_t thread_count) -> std::vector<parse_error>
+   {
+      const auto tokens = make_token_stream(source);
+      REQUIRE(tokens);
+
+      const auto result = parse_tokens(tokens.value());
+      REQUIRE(result.value == parse_status::success);
+
+      ast::visitor_variant tables{symbol_table_visitor{}};
+      result.ast->accept(tables);
+
+      ast::visitor_variant checker{
+         type_checking_visitor{std::get<symbol_table_visitor>(tables).get_root_table(),
+                               thread_count}};
+      result.ast->accept(checker);
+
+      return std::get<type_checking_visitor>(checker).get_errors();
+   }
+} // namespace
+
+TEST_SUITE("Type checking visitor test suite")
+{
+   TEST_CASE("errors are reported in the same order whatever the thread count")
+   {
+      const auto sequential = type_check(1);
+      REQUIRE(std::size(sequential) >= 3);
+
+      for (const std::size_t thread_count : {2U, 3U, 8U})
+      {
+         const auto parallel = type_check(thread_count);
+
+         REQUIRE(std::size(parallel) == std::size(sequential));
+         for (std::size_t i = 0; i < std::size(sequential); ++i)
+         {
+            CHECK(parallel[i].pos == sequential[i].pos);
+            CHECK(parallel[i].lexeme == sequential[i].lexeme);
+         }
+      }
+   }
+}
@@ -3,6 +3,8 @@
 #include <toy_compiler/munster/ast/decl/class_decl.hpp>
 #include <toy_compiler/munster/ast/decl/func_head_decl.hpp>
 #include <toy_compiler/munster/ast/decl/main_decl.hpp>
+#include <toy_compiler/munster/ast/decl/translation_unit_decl.hpp>
+#include <toy_compiler/util/parallel_for.hpp>
 
 #include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/range/conversion.hpp>
@@ -25,9 +27,28 @@ namespace munster
 
    auto is_pod(std::string_view type) -> bool { return type == "integer" || type == "float"; }
 
-   memory_size_visitor::memory_size_visitor(symbol_table* p_root) : mp_root{p_root} {}
+   memory_size_visitor::memory_size_visitor(symbol_table* p_root, std::size_t thread_count) :
+      mp_root{p_root},
+      m_thread_count{thread_count}
+   {}
 
-   void memory_size_visitor::visit(const ast::translation_unit_decl&) {}
+   void memory_size_visitor::visit(const ast::translation_unit_decl& node)
+   {
+      if (m_thread_count <= 1)
+      {
+         return;
+      }
+
+      // the classes were all sized on the way here, the functions only read their sizes
+      const auto& funcs = node.children()[1]->children();
+      util::parallel_for(std::size(funcs), m_thread_count, [&](std::size_t i) {
+         const auto* head = ast::cast<ast::func_head_decl>(funcs[i]->children()[0]);
+         if (auto* p_table = find_function_table(*head))
+         {
+            size_locals(*p_table);
+         }
+      });
+   }
 
    void memory_size_visitor::visit(const ast::compound_class_decl&) {}
    void memory_size_visitor::visit(const ast::class_decl& node)
@@ -78,78 +99,18 @@ namespace munster
    void memory_size_visitor::visit(const ast::compound_function_decl&) {}
    void memory_size_visitor::visit(const ast::func_decl&)
    {
-      symbol_table* table = m_tables.back();
-
-      // const auto param_view = ;
-      for (auto& symbol : table->symbols() | rv::values | rv::filter(is_param))
+      if (m_thread_count <= 1)
       {
-         if (!is_pod(symbol.type()))
-         {
-            const std::string key{symbol.type()};
-            if (auto res = mp_root->lookup(key))
-            {
-               symbol.update_size(res.val().size());
-            }
-         }
-      }
-
-      for (auto& symbol : table->symbols() | rv::values | rv::filter(is_var))
-      {
-         const auto type = symbol.type().substr(0, symbol.type().find_first_of('['));
-
-         if (!is_pod(type))
-         {
-            const std::string key{type};
-            if (auto res = mp_root->lookup(key))
-            {
-               // clang-format off
-               const auto type_data = symbol.type() 
-                  | rv::split('[') 
-                  | rv::tail
-                  | ranges::to<std::vector<std::string>>;
-               // clang-format on
-
-               std::int64_t size = res.val().size();
-               for (const auto& str : type_data)
-               {
-                  size *= std::stoi(str.substr(0, str.find_first_of(']')));
-               }
-
-               symbol.update_size(size);
-            }
-         }
+         size_locals(*m_tables.back());
       }
 
       m_tables.pop_back();
    }
    void memory_size_visitor::visit(const ast::func_head_decl& node)
    {
-      if (node.class_name())
+      if (auto* p_table = find_function_table(node))
       {
-         const std::string class_name{node.lexeme()};
-         const auto func_name = node.class_name().value();
-         const auto key = fmt::format("{} '{} ({})'", func_name, node.return_type(),
-                                      fmt::join(node.params(), ", "));
-
-         if (auto class_entry_res = mp_root->lookup(class_name))
-         {
-            symbol_table* class_table = class_entry_res.val().link();
-            if (auto func_entry_res = class_table->lookup(key))
-            {
-               m_tables.push_back(func_entry_res.val().link());
-            }
-         }
-      }
-      else
-      {
-         const auto func_name = node.lexeme();
-         const auto key = fmt::format("{} '{} ({})'", func_name, node.return_type(),
-                                      fmt::join(node.params(), ", "));
-
-         if (auto func_entry_res = mp_root->lookup(key))
-         {
-            m_tables.push_back(func_entry_res.val().link());
-         }
+         m_tables.push_back(p_table);
       }
    }
    void memory_size_visitor::visit(const ast::func_body_decl&) {}
@@ -218,4 +179,68 @@ namespace munster
    void memory_size_visitor::visit(const ast::add_op&) {}
    void memory_size_visitor::visit(const ast::mult_op&) {}
    void memory_size_visitor::visit(const ast::rel_op&) {}
+
+   auto memory_size_visitor::find_function_table(const ast::func_head_decl& head) const
+      -> symbol_table*
+   {
+      if (head.class_name())
+      {
+         if (auto class_entry_res = mp_root->lookup(head.lexeme_id()))
+         {
+            symbol_table* class_table = class_entry_res.val().link();
+            if (auto func_entry_res = class_table->lookup(head.signature()))
+            {
+               return func_entry_res.val().link();
+            }
+         }
+      }
+      else if (auto func_entry_res = mp_root->lookup(head.signature()))
+      {
+         return func_entry_res.val().link();
+      }
+
+      return nullptr;
+   }
+   void memory_size_visitor::size_locals(symbol_table& table) const
+   {
+      // const auto param_view = ;
+      for (auto& symbol : table.symbols() | rv::values | rv::filter(is_param))
+      {
+         if (!is_pod(symbol.type()))
+         {
+            const std::string key{symbol.type()};
+            if (auto res = mp_root->lookup(key))
+            {
+               symbol.update_size(res.val().size());
+            }
+         }
+      }
+
+      for (auto& symbol : table.symbols() | rv::values | rv::filter(is_var))
+      {
+         const auto type = symbol.type().substr(0, symbol.type().find_first_of('['));
+
+         if (!is_pod(type))
+         {
+            const std::string key{type};
+            if (auto res = mp_root->lookup(key))
+            {
+               // clang-format off
+               const auto type_data = symbol.type() 
+                  | rv::split('[') 
+                  | rv::tail
+                  | ranges::to<std::vector<std::string>>;
+               // clang-format on
+
+               std::int64_t size = res.val().size();
+               for (const auto& str : type_data)
+               {
+                  size *= std::stoi(str.substr(0, str.find_first_of(']')));
+               }
+
+               symbol.update_size(size);
+            }
+         }
+      }
+   }
 } // namespace munster
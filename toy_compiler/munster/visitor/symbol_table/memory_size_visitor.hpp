@@ -9,7 +9,12 @@ namespace munster
       friend visitor<memory_size_visitor>;
 
    public:
-      memory_size_visitor(symbol_table* p_root);
+      /**
+       * @brief The locals of the functions are sized once the whole translation unit was
+       * visited, spread over `thread_count` threads, instead of as each function is visited
+       * when `thread_count` is more than 1
+       */
+      memory_size_visitor(symbol_table* p_root, std::size_t thread_count = 1);
 
    private:
       void visit(const ast::translation_unit_decl& node);
@@ -59,8 +64,16 @@ namespace munster
       void visit(const ast::mult_op& node);
       void visit(const ast::rel_op& node);
 
+      [[nodiscard]] auto find_function_table(const ast::func_head_decl& head) const
+         -> symbol_table*;
+      /**
+       * @brief Size the parameters and variables of a function whose classes are already sized
+       */
+      void size_locals(symbol_table& table) const;
+
    private:
       symbol_table* mp_root{};
+      std::size_t m_thread_count{1};
 
       std::vector<symbol_table*> m_tables;
       std::vector<symbol*> m_symbols;
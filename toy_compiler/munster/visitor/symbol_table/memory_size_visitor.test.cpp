@@ -0,0 +1,155 @@
+/**
+ * @brief Runs tests on functions defined in memory_size_visitor.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/munster/lexer.hpp>
+#include <toy_compiler/munster/parser.hpp>
+#include <toy_compiler/munster/visitor/symbol_table/memory_size_visitor.hpp>
+#include <toy_compiler/munster/visitor/symbol_table/symbol_table_visitor.hpp>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+using namespace munster;
+
+namespace
+{
+   constexpr std::string_view source = R"(
+class POINT {
+  public float x;
+  public float y;
+
+  public func length() : float;
+};
+
+class SEGMENT {
+  public POINT a;
+  public POINT b;
+};
+
+func POINT::length() : float
+{
+  var
+  {
+    float result;
+  }
+  result = x * x + y * y;
+  return (result);
+}
+
+func middle(SEGMENT s) : POINT
+{
+  var
+  {
+    POINT result;
+  }
+  return (result);
+}
+
+func path(integer count) : integer
+{
+  var
+  {
+    POINT points[4];
+    SEGMENT segments[2][3];
+  }
+  return (count);
+}
+
+func copy(POINT p, SEGMENT s) : integer
+{
+  var
+  {
+    SEGMENT other;
+  }
+  return (1);
+}
+
+main
+{
+  var
+  {
+    SEGMENT s;
+    integer x;
+  }
+  x = 1;
+}
+)";
+
+   using sized_symbol = std::tuple<std::string, std::string, std::int64_t>;
+
+   void collect_sizes(const symbol_table& table, std::vector<sized_symbol>& sizes)
+   {
+      for (const auto& [key, symbol] : table.symbols())
+      {
+         sizes.emplace_back(std::string{table.name()}, std::string{symbol.name()}, symbol.size());
+
+         if (const auto* p_link = symbol.link())
+         {
+            collect_sizes(*p_link, sizes);
+         }
+      }
+   }
+
+   /**
+    * @brief Build the symbol tables of the source then size them with `thread_count` threads
+    *
+    * @return The size of every symbol of every table, along with the name of its table
+    */
+   auto size_tables(std::size_t thread_count) -> std::vector<sized_symbol>
+   {
+      const auto tokens = make_token_stream(source);
+      REQUIRE(tokens);
+
+      const auto result = parse_tokens(tokens.value());
+      REQUIRE(result.value == parse_status::success);
+
+      ast::visitor_variant tables{symbol_table_visitor{}};
+      result.ast->accept(tables);
+
+      auto* p_root = std::get<symbol_table_visitor>(tables).get_root_table();
+
+      ast::visitor_variant sizes_visitor{memory_size_visitor{p_root, thread_count}};
+      result.ast->accept(sizes_visitor);
+
+      std::vector<sized_symbol> sizes;
+      collect_sizes(*p_root, sizes);
+      std::ranges::sort(sizes);
+
+      return sizes;
+   }
+} // namespace
+
+TEST_SUITE("Memory size visitor test suite")
+{
+   TEST_CASE("tables are sized the same whatever the thread count")
+   {
+      const auto sequential = size_tables(1);
+      REQUIRE_FALSE(std::empty(sequential));
+
+      for (const std::size_t thread_count : {2U, 3U, 8U})
+      {
+         CHECK(size_tables(thread_count) == sequential);
+      }
+   }
+}
@@ -30,7 +30,6 @@
 
 #include <mpark/patterns.hpp>
 
-#include <map>
 
 namespace vi = ranges::views;
 using namespace mpark::patterns;
@@ -44,12 +43,6 @@ namespace munster
       return temp;
    }
 
-   template <typename Any>
-   auto to(const ast::node_ptr& node) -> Any*
-   {
-      return dynamic_cast<Any*>(node.get());
-   }
-
    auto array_index_to_string(std::int64_t i) -> std::string
    {
       if (i >= 0)
@@ -69,18 +62,17 @@ namespace munster
 
       for (const auto& node : tl.children()[0]->children())
       {
-         auto* value = dynamic_cast<ast::class_decl*>(node.get());
+         auto* value = ast::cast<ast::class_decl>(node);
 
          const std::string name{value->lexeme()};
-
-         std::iter_swap(ranges::find(m_tables, name, &symbol_table::name), std::end(m_tables) - 1);
+         auto class_table = take_pending(value->lexeme_id(), symbol_table_type::e_class);
 
          auto result = table->insert(name,
                                      symbol{{.name = name,
                                              .kind = symbol_type::e_class,
                                              .location = value->location(),
                                              .type = "",
-                                             .link = pop_back(m_tables)}});
+                                             .link = std::move(class_table)}});
 
          if (!result.is_inserted())
          {
@@ -93,22 +85,26 @@ namespace munster
          }
       }
 
+      for (const auto& node : tl.children()[0]->children())
+      {
+         link_base_classes(*ast::cast<ast::class_decl>(node), *table);
+      }
+
       for (const auto& node : tl.children()[1]->children())
       {
-         auto* func = dynamic_cast<ast::func_decl*>(node.get());
-         auto* func_head = dynamic_cast<ast::func_head_decl*>(func->children()[0].get());
+         auto* func = ast::cast<ast::func_decl>(node);
+         auto* func_head = ast::cast<ast::func_head_decl>(func->children()[0]);
 
          const std::string name{func_head->lexeme()};
          const auto type =
             fmt::format("{} ({})", func_head->return_type(), fmt::join(func_head->params(), ", "));
-         const auto key = fmt::format("{} '{} ({})'", func_head->lexeme(), func_head->return_type(),
-                                      fmt::join(func_head->params(), ", "));
+         // member function definitions are keyed on the class name here, not on the function name
+         const auto key = func_head->class_name()
+            ? intern_signature(func_head->lexeme(), func_head->return_type(), func_head->params())
+            : func_head->signature();
 
-         const auto it = ranges::find(m_tables, name, &symbol_table::name);
-         if (it != std::end(m_tables))
+         if (auto func_table = take_pending(func_head->lexeme_id(), symbol_table_type::e_func))
          {
-            std::iter_swap(it, std::end(m_tables) - 1);
-
             // crosscheck params
 
             auto result = table->insert(key,
@@ -116,7 +112,7 @@ namespace munster
                                                 .kind = symbol_type::e_function,
                                                 .location = func->location(),
                                                 .type = type,
-                                                .link = pop_back(m_tables)}});
+                                                .link = std::move(func_table)}});
 
             if (!result.is_inserted())
             {
@@ -131,17 +127,14 @@ namespace munster
       const auto* main_func = tl.children()[2].get();
       const std::string name{main_func->lexeme()};
 
-      const auto it = ranges::find(m_tables, name, &symbol_table::name);
-      if (it != std::end(m_tables))
+      if (auto main_table = take_pending(main_func->lexeme_id(), symbol_table_type::e_main))
       {
-         std::iter_swap(it, std::end(m_tables) - 1);
-
          auto result = table->insert(name,
                                      symbol{{.name = name,
                                              .kind = symbol_type::e_main,
                                              .location = main_func->location(),
                                              .type = "",
-                                             .link = pop_back(m_tables)}});
+                                             .link = std::move(main_table)}});
 
          if (!result.is_inserted())
          {
@@ -179,7 +172,7 @@ namespace munster
       for (auto [key, sym] : m_symbols | vi::filter(is_inheritance) | vi::move)
       {
          const std::string name{sym.name()};
-         if (ranges::find(m_tables, name, &symbol_table::name) != std::end(m_tables))
+         if (find_pending(key.name(), symbol_table_type::e_class))
          {
             const auto location = sym.location();
 
@@ -213,7 +206,6 @@ namespace munster
          }
       }
 
-      std::map<std::string_view, int> duplicates_counter;
       for (auto [key, sym] : m_symbols | vi::filter(is_mem_func) | vi::move)
       {
          const auto name = sym.name();
@@ -231,8 +223,7 @@ namespace munster
          }
          else
          {
-            const auto dup = duplicates_counter.insert({name, 1});
-            if (dup.second == false)
+            if (std::size(table->overloads(key.name())) > 1)
             {
                const parse_error err{
                   .type = parse_error_type::e_semantic_warning,
@@ -246,14 +237,14 @@ namespace munster
       }
 
       m_symbols.clear();
-      m_tables.push_back(std::move(table));
+      add_pending(std::move(table));
    }
    void symbol_table_visitor::visit(const ast::compound_inheritance_decl&) {}
    void symbol_table_visitor::visit(const ast::inheritance_decl& node)
    {
       const std::string name{node.lexeme()};
       m_symbols.push_back(
-         {.key = name,
+         {.key = node.lexeme_id(),
           .val = symbol{
              {.name = name, .kind = symbol_type::e_inheritance, .location = node.location()}}});
    }
@@ -263,10 +254,7 @@ namespace munster
       const std::string name{node.lexeme()};
       const auto type =
          fmt::format("{} '{} ({})'", node.visibility(), node.return_type(), node.params_string());
-      const auto key =
-         fmt::format("{} '{} ({})'", node.lexeme(), node.return_type(), node.params_string());
-
-      m_symbols.push_back({.key = key,
+      m_symbols.push_back({.key = symbol_key{node.lexeme_id(), node.signature()},
                            .val = symbol{{.name = name,
                                           .kind = symbol_type::e_member_function,
                                           .location = node.location(),
@@ -289,7 +277,7 @@ namespace munster
          }
       }
 
-      m_symbols.push_back({.key = name,
+      m_symbols.push_back({.key = node.lexeme_id(),
                            .val = symbol{{.name = name,
                                           .kind = symbol_type::e_member_variable,
                                           .location = node.location(),
@@ -306,21 +294,16 @@ namespace munster
 
       handle_variables(table);
 
-      const auto* head = to<ast::func_head_decl>(node.children()[0]);
+      const auto* head = ast::dyn_cast<ast::func_head_decl>(node.children()[0]);
       if (head->class_name())
       {
          const auto class_name = head->class_name().value();
-         const auto class_it = ranges::find(m_tables, head->lexeme(), &symbol_table::name);
-         if (class_it != std::end(m_tables))
+         if (auto* p_class_table = find_pending(head->lexeme_id(), symbol_table_type::e_class))
          {
-            const auto& class_table = *class_it;
-
-            const auto key = fmt::format("{} '{} ({})'", class_name, head->return_type(),
-                                         fmt::join(head->params(), ", "));
-
-            auto result = class_table->lookup(key);
+            auto result = p_class_table->lookup(head->signature());
             if (result)
             {
+               table->set_parent(p_class_table);
                result.val().set_table(std::move(table));
             }
             else
@@ -341,7 +324,7 @@ namespace munster
       }
       else
       {
-         m_tables.push_back(std::move(table));
+         add_pending(std::move(table));
       }
    }
    void symbol_table_visitor::visit(const ast::func_head_decl& node)
@@ -372,7 +355,7 @@ namespace munster
 
       handle_variables(table);
 
-      m_tables.push_back(std::move(table));
+      add_pending(std::move(table));
    }
 
    void symbol_table_visitor::visit(const ast::compound_params_decl&) {}
@@ -393,7 +376,7 @@ namespace munster
          }
       }
 
-      m_symbols.push_back({.key = name,
+      m_symbols.push_back({.key = node.lexeme_id(),
                            .val = symbol({.name = name,
                                           .kind = symbol_type::e_variable,
                                           .location = node.location(),
@@ -444,13 +427,83 @@ namespace munster
       return m_tables.back().get();
    }
 
+   void symbol_table_visitor::add_pending(std::unique_ptr<symbol_table> table)
+   {
+      m_pending_tables.try_emplace(intern(table->name())).first->second.push_back(std::move(table));
+   }
+   auto symbol_table_visitor::take_pending(string_id name, symbol_table_type kind)
+      -> std::unique_ptr<symbol_table>
+   {
+      const auto it = m_pending_tables.find(name);
+      if (it == std::end(m_pending_tables))
+      {
+         return nullptr;
+      }
+
+      const auto table_it = ranges::find(it->second, kind, &symbol_table::kind);
+      if (table_it == std::end(it->second))
+      {
+         return nullptr;
+      }
+
+      auto table = std::move(*table_it);
+      it->second.erase(table_it);
+
+      return table;
+   }
+   auto symbol_table_visitor::find_pending(string_id name, symbol_table_type kind) const
+      -> symbol_table*
+   {
+      const auto it = m_pending_tables.find(name);
+      if (it == std::end(m_pending_tables))
+      {
+         return nullptr;
+      }
+
+      const auto table_it = ranges::find(it->second, kind, &symbol_table::kind);
+      return table_it != std::end(it->second) ? table_it->get() : nullptr;
+   }
+
+   void symbol_table_visitor::link_base_classes(const ast::class_decl& node, symbol_table& root)
+   {
+      const auto class_res = root.lookup(node.lexeme_id());
+      if (!class_res || std::empty(node.children()) ||
+          !ast::isa<ast::compound_inheritance_decl>(node.children()[0]))
+      {
+         return;
+      }
+
+      symbol_table* p_class_table = class_res.val().link();
+      for (const auto& base : node.children()[0]->children())
+      {
+         // bases that were not declared before the class have no inheritance symbol
+         const auto inheritance_res = p_class_table->lookup(base->lexeme_id());
+         const auto base_res = root.lookup(base->lexeme_id());
+         if (!inheritance_res || inheritance_res.val().kind() != symbol_type::e_inheritance ||
+             !base_res || base_res.val().kind() != symbol_type::e_class)
+         {
+            continue;
+         }
+
+         if (!p_class_table->add_base(base_res.val().link()))
+         {
+            m_errors.push_back({.type = parse_error_type::e_semantic_error,
+                                .pos = base->location(),
+                                .lexeme = fmt::format("class '{}' cannot inherit from '{}', it "
+                                                      "would inherit from itself",
+                                                      node.lexeme(), base->lexeme())});
+         }
+      }
+   }
+
    auto symbol_table_visitor::generate_var_symbols(const ast::node* head) -> std::vector<symbol>
    {
       std::vector<symbol> symbols;
       if (!std::empty(head->children()))
       {
          const auto& params = head->children()[0];
-         for (const auto* var : params->children() | vi::transform(to<ast::variable_decl>))
+         for (const auto* var :
+              params->children() | vi::transform(ast::cast_to<ast::variable_decl>))
          {
             const std::string name{var->lexeme()};
 
@@ -469,7 +522,7 @@ namespace munster
 
                const auto& array_decls = var->children()[0];
                for (const auto* array :
-                    array_decls->children() | vi::transform(to<ast::array_decl>))
+                    array_decls->children() | vi::transform(ast::cast_to<ast::array_decl>))
                {
                   type += fmt::format("[{}]", array->lexeme());
                }
@@ -545,20 +598,8 @@ namespace munster
          }
          else
          {
-            const auto is_class = [](std::unique_ptr<symbol_table>& t) {
-               return t->kind() == symbol_table_type::e_class;
-            };
-
-            bool is_present = false;
-            for (const auto& test : m_tables | vi::filter(is_class))
-            {
-               if (test->name() == type)
-               {
-                  is_present = true;
-               }
-            }
-
-            if (is_present)
+            const auto type_id = string_interner::global().find(type);
+            if (type_id && find_pending(type_id.value(), symbol_table_type::e_class))
             {
                const auto result = p_table->insert(key, std::move(symbol));
                if (!result.is_inserted())
@@ -632,20 +673,8 @@ namespace munster
          }
          else
          {
-            const auto is_class = [](std::unique_ptr<symbol_table>& t) {
-               return t->kind() == symbol_table_type::e_class;
-            };
-
-            bool is_present = false;
-            for (const auto& test : m_tables | vi::filter(is_class))
-            {
-               if (test->name() == type)
-               {
-                  is_present = true;
-               }
-            }
-
-            if (is_present)
+            const auto type_id = string_interner::global().find(type);
+            if (type_id && find_pending(type_id.value(), symbol_table_type::e_class))
             {
                const auto result = p_table->insert(key, std::move(symbol));
                if (!result.is_inserted())
@@ -10,7 +10,7 @@ namespace munster
 
       struct symbol_kv
       {
-         std::string key;
+         symbol_key key;
          symbol val;
       };
 
@@ -66,6 +66,25 @@ namespace munster
       void visit(const ast::rel_op& node);
 
    private:
+      /**
+       * @brief Keep a finished class, function or main table until the translation unit takes
+       * it. Tables are indexed by name so the translation unit finds each of them in constant time
+       */
+      void add_pending(std::unique_ptr<symbol_table> table);
+      /**
+       * @brief Take the first pending table of kind `kind` named `name`, the tables of
+       * overloaded functions are taken in the order they were declared
+       */
+      auto take_pending(string_id name, symbol_table_type kind) -> std::unique_ptr<symbol_table>;
+      [[nodiscard]] auto find_pending(string_id name, symbol_table_type kind) const
+         -> symbol_table*;
+
+      /**
+       * @brief Make the table of the class declared by `node` inherit from the tables of its base
+       * classes, in the order they are declared
+       */
+      void link_base_classes(const ast::class_decl& node, symbol_table& root);
+
       auto generate_var_symbols(const ast::node* head) -> std::vector<symbol>;
 
       void handle_parameters(std::unique_ptr<symbol_table>& p_table);
@@ -78,6 +97,7 @@ namespace munster
 
    private:
       std::vector<std::unique_ptr<symbol_table>> m_tables;
+      util::flat_hash_map<string_id, std::vector<std::unique_ptr<symbol_table>>> m_pending_tables;
       std::vector<symbol_kv> m_symbols;
       std::vector<std::int64_t> m_array_sizes;
    };
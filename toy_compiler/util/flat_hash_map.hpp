@@ -0,0 +1,653 @@
+/**
+ * @file flat_hash_map.hpp
+ * @brief Contains an open addressing hash map with a flat array of control bytes
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace util
+{
+   namespace detail
+   {
+      inline constexpr std::size_t group_width = 16;
+
+      inline constexpr std::int8_t empty_control = -128;
+      inline constexpr std::int8_t deleted_control = -2;
+
+      /**
+       * @brief One bit for each of the control bytes of a group that matched
+       */
+      using group_mask = std::uint32_t;
+
+      /**
+       * @brief The `group_width` control bytes looked at on each step of a probe. Each control
+       * byte is either `empty_control`, `deleted_control`, or the 7 bit tag of the hash of the
+       * key stored in the slot
+       */
+      class control_group
+      {
+      public:
+         explicit control_group(const std::int8_t* p_control)
+         {
+#if defined(__SSE2__)
+            m_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_control)); // NOLINT
+#else
+            std::memcpy(std::data(m_bytes), p_control, group_width);
+#endif
+         }
+
+         [[nodiscard]] auto match(std::int8_t tag) const -> group_mask
+         {
+#if defined(__SSE2__)
+            return to_mask(_mm_cmpeq_epi8(m_bytes, _mm_set1_epi8(tag)));
+#else
+            return match_if([=](std::int8_t control) {
+               return control == tag;
+            });
+#endif
+         }
+         [[nodiscard]] auto match_empty() const -> group_mask
+         {
+#if defined(__SSE2__)
+            return to_mask(_mm_cmpeq_epi8(m_bytes, _mm_set1_epi8(empty_control)));
+#else
+            return match_if([](std::int8_t control) {
+               return control == empty_control;
+            });
+#endif
+         }
+         /**
+          * @brief Match the slots that are either empty or deleted, both have their sign bit set
+          */
+         [[nodiscard]] auto match_free() const -> group_mask
+         {
+#if defined(__SSE2__)
+            return to_mask(m_bytes);
+#else
+            return match_if([](std::int8_t control) {
+               return control < 0;
+            });
+#endif
+         }
+
+      private:
+#if defined(__SSE2__)
+         static auto to_mask(__m128i bytes) -> group_mask
+         {
+            return static_cast<group_mask>(_mm_movemask_epi8(bytes));
+         }
+
+         __m128i m_bytes;
+#else
+         template <typename Pred>
+         auto match_if(Pred pred) const -> group_mask
+         {
+            group_mask mask = 0;
+            for (std::size_t i = 0; i < group_width; ++i)
+            {
+               if (pred(m_bytes[i]))
+               {
+                  mask |= group_mask{1} << i;
+               }
+            }
+
+            return mask;
+         }
+
+         std::array<std::int8_t, group_width> m_bytes{};
+#endif
+      };
+   } // namespace detail
+
+   /**
+    * @brief A hash map storing its keys in open addressing, in the way of SwissTable. The table is
+    * a flat array of one byte per slot holding 7 bits of the hash of its key, probed
+    * `detail::group_width` slots at a time, next to a flat array of pointers to the entries. A
+    * lookup only touches the entry of a slot whose tag matched, so it rarely compares keys that
+    * are not equal.
+    *
+    * Entries are allocated in chunks that never move, so, as with `std::unordered_map`,
+    * references to the entries stay valid until the entry is erased, even when the table grows.
+    *
+    * When both `hash_` and `equal_` are transparent, lookups may be done with any type they
+    * accept, such as a `std::string_view` for `std::string` keys
+    */
+   template <typename key_, typename value_, typename hash_ = std::hash<key_>,
+             typename equal_ = std::equal_to<key_>>
+   class flat_hash_map
+   {
+      static constexpr std::size_t min_capacity = detail::group_width;
+      static constexpr std::size_t first_chunk_size = 4;
+      static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+      static constexpr bool is_transparent = requires {
+         typename hash_::is_transparent;
+         typename equal_::is_transparent;
+      };
+      /**
+       * @brief Small keys are copied next to the pointer to their entry, so a probe never has to
+       * leave the slot array to compare them
+       */
+      static constexpr bool is_key_inlined = std::is_trivially_copyable_v<key_> &&
+         std::is_default_constructible_v<key_> && sizeof(key_) <= 2 * sizeof(void*);
+
+      struct no_key
+      {
+      };
+
+      struct slot
+      {
+         std::pair<const key_, value_>* p_entry{nullptr};
+         [[no_unique_address]] std::conditional_t<is_key_inlined, key_, no_key> key{};
+      };
+
+   public:
+      using key_type = key_;
+      using mapped_type = value_;
+      using value_type = std::pair<const key_, value_>;
+      using size_type = std::size_t;
+      using hasher = hash_;
+      using key_equal = equal_;
+
+      template <bool is_const_>
+      class basic_iterator
+      {
+         friend flat_hash_map;
+
+         template <bool>
+         friend class basic_iterator;
+
+      public:
+         using iterator_category = std::forward_iterator_tag;
+         using value_type = flat_hash_map::value_type;
+         using difference_type = std::ptrdiff_t;
+         using pointer = std::conditional_t<is_const_, const value_type*, value_type*>;
+         using reference = std::conditional_t<is_const_, const value_type&, value_type&>;
+
+      public:
+         basic_iterator() = default;
+         template <bool is_other_const_>
+         basic_iterator(const basic_iterator<is_other_const_>& other) requires(
+            is_const_ && !is_other_const_) :
+            mp_control{other.mp_control},
+            mp_control_end{other.mp_control_end},
+            mp_slot{other.mp_slot}
+         {}
+
+         auto operator*() const -> reference { return *mp_slot->p_entry; }
+         auto operator->() const -> pointer { return mp_slot->p_entry; }
+
+         auto operator++() -> basic_iterator&
+         {
+            ++mp_control;
+            ++mp_slot;
+            skip_free_slots();
+
+            return *this;
+         }
+         auto operator++(int) -> basic_iterator
+         {
+            auto copy = *this;
+            ++(*this);
+
+            return copy;
+         }
+
+         friend auto operator==(const basic_iterator& lhs, const basic_iterator& rhs) -> bool
+         {
+            return lhs.mp_control == rhs.mp_control;
+         }
+
+      private:
+         basic_iterator(const std::int8_t* p_control, const std::int8_t* p_control_end,
+                        const slot* p_slot) :
+            mp_control{p_control},
+            mp_control_end{p_control_end},
+            mp_slot{p_slot}
+         {}
+
+         void skip_free_slots()
+         {
+            while (mp_control != mp_control_end && *mp_control < 0)
+            {
+               ++mp_control;
+               ++mp_slot;
+            }
+         }
+
+         const std::int8_t* mp_control{nullptr};
+         const std::int8_t* mp_control_end{nullptr};
+         const slot* mp_slot{nullptr};
+      };
+
+      using iterator = basic_iterator<false>;
+      using const_iterator = basic_iterator<true>;
+
+   public:
+      flat_hash_map() = default;
+      flat_hash_map(const flat_hash_map&) = delete;
+      flat_hash_map(flat_hash_map&& other) noexcept :
+         m_control{std::move(other.m_control)},
+         m_slots{std::move(other.m_slots)},
+         m_chunks{std::exchange(other.m_chunks, {})},
+         m_free_entries{std::move(other.m_free_entries)},
+         m_size{std::exchange(other.m_size, 0)},
+         m_growth_left{std::exchange(other.m_growth_left, 0)}
+      {
+         other.m_control.clear();
+         other.m_slots.clear();
+         other.m_free_entries.clear();
+      }
+      ~flat_hash_map() { release(); }
+
+      auto operator=(const flat_hash_map&) -> flat_hash_map& = delete;
+      auto operator=(flat_hash_map&& rhs) noexcept -> flat_hash_map&
+      {
+         if (this != &rhs)
+         {
+            release();
+
+            m_control = std::move(rhs.m_control);
+            m_slots = std::move(rhs.m_slots);
+            m_chunks = std::exchange(rhs.m_chunks, {});
+            m_free_entries = std::move(rhs.m_free_entries);
+            m_size = std::exchange(rhs.m_size, 0);
+            m_growth_left = std::exchange(rhs.m_growth_left, 0);
+
+            rhs.m_control.clear();
+            rhs.m_slots.clear();
+            rhs.m_free_entries.clear();
+         }
+
+         return *this;
+      }
+
+      [[nodiscard]] auto begin() noexcept -> iterator { return make_iterator<iterator>(0); }
+      [[nodiscard]] auto begin() const noexcept -> const_iterator
+      {
+         return make_iterator<const_iterator>(0);
+      }
+      [[nodiscard]] auto end() noexcept -> iterator { return make_iterator<iterator>(capacity()); }
+      [[nodiscard]] auto end() const noexcept -> const_iterator
+      {
+         return make_iterator<const_iterator>(capacity());
+      }
+
+      [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+      [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+      /**
+       * @brief The number of slots of the table, a power of two
+       */
+      [[nodiscard]] auto capacity() const noexcept -> size_type { return std::size(m_control); }
+
+      template <typename any_ = key_type>
+      [[nodiscard]] auto find(const any_& key) -> iterator
+         requires(std::is_same_v<any_, key_type> || is_transparent)
+      {
+         const auto index = find_index(key, hash_of(key));
+         return index == npos ? end() : make_iterator<iterator>(index);
+      }
+      template <typename any_ = key_type>
+      [[nodiscard]] auto find(const any_& key) const -> const_iterator
+         requires(std::is_same_v<any_, key_type> || is_transparent)
+      {
+         const auto index = find_index(key, hash_of(key));
+         return index == npos ? end() : make_iterator<const_iterator>(index);
+      }
+      template <typename any_ = key_type>
+      [[nodiscard]] auto contains(const any_& key) const -> bool
+         requires(std::is_same_v<any_, key_type> || is_transparent)
+      {
+         return find_index(key, hash_of(key)) != npos;
+      }
+
+      /**
+       * @brief Construct the value in place from `args` if no entry has a key equal to `key`.
+       * Gives back the entry with the key and whether it was inserted
+       */
+      template <typename any_, typename... args_>
+      auto try_emplace(any_&& key, args_&&... args) -> std::pair<iterator, bool>
+      {
+         const auto hash = hash_of(key);
+         if (const auto index = find_index(key, hash); index != npos)
+         {
+            return {make_iterator<iterator>(index), false};
+         }
+
+         if (m_growth_left == 0)
+         {
+            grow();
+         }
+
+         const auto index = find_free_index(hash);
+         if (m_control[index] == detail::empty_control)
+         {
+            --m_growth_left;
+         }
+
+         m_control[index] = tag_of(hash);
+         auto* p_entry = make_entry(std::piecewise_construct,
+                                    std::forward_as_tuple(std::forward<any_>(key)),
+                                    std::forward_as_tuple(std::forward<args_>(args)...));
+         if constexpr (is_key_inlined)
+         {
+            m_slots[index] = {.p_entry = p_entry, .key = p_entry->first};
+         }
+         else
+         {
+            m_slots[index] = {.p_entry = p_entry};
+         }
+         ++m_size;
+
+         return {make_iterator<iterator>(index), true};
+      }
+      auto insert(value_type&& value) -> std::pair<iterator, bool>
+      {
+         return try_emplace(value.first, std::move(value.second));
+      }
+
+      void erase(iterator it) { erase(const_iterator{it}); }
+      void erase(const_iterator it)
+      {
+         const auto index = static_cast<size_type>(it.mp_control - std::data(m_control));
+
+         destroy_entry(m_slots[index].p_entry);
+         m_slots[index] = {};
+         --m_size;
+
+         // A probe only goes past a group without any empty slot, if the group of the slot has
+         // one, no probe ever went through it and the slot can be made empty again
+         const auto group_start = index - index % detail::group_width;
+         if (detail::control_group{std::data(m_control) + group_start}.match_empty() != 0)
+         {
+            m_control[index] = detail::empty_control;
+            ++m_growth_left;
+         }
+         else
+         {
+            m_control[index] = detail::deleted_control;
+         }
+      }
+      template <typename any_ = key_type>
+      auto erase(const any_& key) -> size_type
+         requires(std::is_same_v<any_, key_type> || is_transparent)
+      {
+         const auto it = find(key);
+         if (it == end())
+         {
+            return 0;
+         }
+
+         erase(it);
+
+         return 1;
+      }
+
+      void clear() { release(); }
+
+      /**
+       * @brief Make room for `count` entries without growing the table again
+       */
+      void reserve(size_type count)
+      {
+         auto target = min_capacity;
+         while (max_load(target) < count)
+         {
+            target *= 2;
+         }
+
+         if (target > capacity())
+         {
+            rehash(target);
+         }
+      }
+
+   private:
+      struct chunk
+      {
+         value_type* p_data;
+         size_type count;
+         size_type used;
+      };
+
+      /**
+       * @brief The most entries a table of `slot_count` slots holds, a load factor of 7/8
+       */
+      static constexpr auto max_load(size_type slot_count) -> size_type
+      {
+         return slot_count - slot_count / 8;
+      }
+
+      /**
+       * @brief Spread the bits of the hash, `std::hash` is the identity for integers on most
+       * standard libraries, which would put consecutive keys in the same groups and give them
+       * the same tags
+       */
+      template <typename any_>
+      auto hash_of(const any_& key) const -> std::uint64_t
+      {
+         const auto product = static_cast<std::uint64_t>(m_hash(key)) * 0x9e3779b97f4a7c15ULL;
+         return product ^ (product >> 32U); // NOLINT
+      }
+      static auto tag_of(std::uint64_t hash) -> std::int8_t
+      {
+         return static_cast<std::int8_t>(hash >> 57U); // NOLINT
+      }
+      static auto key_of(const slot& s) -> const key_&
+      {
+         if constexpr (is_key_inlined)
+         {
+            return s.key;
+         }
+         else
+         {
+            return s.p_entry->first;
+         }
+      }
+
+      template <typename iterator_>
+      auto make_iterator(size_type index) const -> iterator_
+      {
+         const auto* p_control = std::data(m_control);
+         iterator_ it{p_control + index, p_control + capacity(), std::data(m_slots) + index};
+         it.skip_free_slots();
+
+         return it;
+      }
+
+      /**
+       * @brief Call `fn` with the index of the first slot of each group on the probe sequence of
+       * `hash` until it returns true. The group steps grow by one at every probe, which visits
+       * every group once since there is a power of two of them
+       */
+      template <typename fn_>
+      auto probe(std::uint64_t hash, fn_ fn) const -> size_type
+      {
+         const auto group_count = capacity() / detail::group_width;
+         auto group = static_cast<size_type>(hash) & (group_count - 1);
+
+         for (size_type step = 1;; ++step)
+         {
+            const auto group_start = group * detail::group_width;
+            if (const auto index = fn(group_start); index != npos)
+            {
+               return index;
+            }
+
+            group = (group + step) & (group_count - 1);
+         }
+      }
+
+      template <typename any_>
+      auto find_index(const any_& key, std::uint64_t hash) const -> size_type
+      {
+         if (m_size == 0)
+         {
+            return npos;
+         }
+
+         const auto tag = tag_of(hash);
+         const auto not_found = capacity();
+
+         const auto index = probe(hash, [&](size_type group_start) -> size_type {
+            const detail::control_group group{std::data(m_control) + group_start};
+            for (auto mask = group.match(tag); mask != 0; mask &= mask - 1)
+            {
+               const auto i = group_start + static_cast<size_type>(std::countr_zero(mask));
+               if (m_equal(key_of(m_slots[i]), key))
+               {
+                  return i;
+               }
+            }
+
+            // the key would have been stored in the empty slot
+            return group.match_empty() != 0 ? not_found : npos;
+         });
+
+         return index == not_found ? npos : index;
+      }
+      auto find_free_index(std::uint64_t hash) const -> size_type
+      {
+         return probe(hash, [&](size_type group_start) -> size_type {
+            const detail::control_group group{std::data(m_control) + group_start};
+
+            const auto mask = group.match_free();
+            return mask == 0 ? npos
+                             : group_start + static_cast<size_type>(std::countr_zero(mask));
+         });
+      }
+
+      void grow()
+      {
+         // reuse the slots left by erased entries if they make up for most of the load
+         if (capacity() != 0 && m_size < max_load(capacity()) / 2)
+         {
+            rehash(capacity());
+         }
+         else
+         {
+            rehash(std::max(capacity() * 2, min_capacity));
+         }
+      }
+      void rehash(size_type slot_count)
+      {
+         auto control = std::exchange(m_control,
+                                      std::vector<std::int8_t>(slot_count, detail::empty_control));
+         auto slots = std::exchange(m_slots, std::vector<slot>(slot_count));
+
+         for (size_type i = 0; i < std::size(control); ++i)
+         {
+            if (control[i] >= 0)
+            {
+               const auto hash = hash_of(key_of(slots[i]));
+               const auto index = find_free_index(hash);
+
+               m_control[index] = tag_of(hash);
+               m_slots[index] = slots[i];
+            }
+         }
+
+         m_growth_left = max_load(slot_count) - m_size;
+      }
+
+      template <typename... args_>
+      auto make_entry(args_&&... args) -> value_type*
+      {
+         value_type* p_entry = nullptr;
+         if (!std::empty(m_free_entries))
+         {
+            p_entry = m_free_entries.back();
+            m_free_entries.pop_back();
+         }
+         else
+         {
+            if (std::empty(m_chunks) || m_chunks.back().used == m_chunks.back().count)
+            {
+               const auto count = std::empty(m_chunks) ? first_chunk_size
+                                                       : m_chunks.back().count * 2;
+               m_chunks.push_back({.p_data = std::allocator<value_type>{}.allocate(count),
+                                   .count = count,
+                                   .used = 0});
+            }
+
+            auto& last = m_chunks.back();
+            p_entry = last.p_data + last.used++;
+         }
+
+         return std::construct_at(p_entry, std::forward<args_>(args)...);
+      }
+      void destroy_entry(value_type* p_entry)
+      {
+         std::destroy_at(p_entry);
+         m_free_entries.push_back(p_entry);
+      }
+
+      void release()
+      {
+         for (size_type i = 0; i < std::size(m_control); ++i)
+         {
+            if (m_control[i] >= 0)
+            {
+               std::destroy_at(m_slots[i].p_entry);
+            }
+         }
+
+         for (const auto& c : m_chunks)
+         {
+            std::allocator<value_type>{}.deallocate(c.p_data, c.count);
+         }
+
+         m_control.clear();
+         m_slots.clear();
+         m_chunks.clear();
+         m_free_entries.clear();
+         m_size = 0;
+         m_growth_left = 0;
+      }
+
+   private:
+      std::vector<std::int8_t> m_control;
+      std::vector<slot> m_slots;
+
+      std::vector<chunk> m_chunks;
+      std::vector<value_type*> m_free_entries;
+
+      size_type m_size{0};
+      size_type m_growth_left{0};
+
+      [[no_unique_address]] hash_ m_hash{};
+      [[no_unique_address]] equal_ m_equal{};
+   };
+} // namespace util
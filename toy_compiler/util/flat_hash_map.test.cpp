@@ -0,0 +1,176 @@
+/**
+ * @brief Runs tests on functions defined in flat_hash_map.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/util/flat_hash_map.hpp>
+
+#include <fmt/core.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace
+{
+   struct string_hash
+   {
+      using is_transparent = void;
+
+      auto operator()(std::string_view value) const -> std::size_t
+      {
+         return std::hash<std::string_view>{}(value);
+      }
+   };
+} // namespace
+
+TEST_SUITE("Flat hash map test suite")
+{
+   TEST_CASE("empty map")
+   {
+      util::flat_hash_map<int, int> map;
+
+      CHECK(map.empty());
+      CHECK(map.size() == 0);
+      CHECK(map.capacity() == 0);
+      CHECK(map.find(1) == map.end());
+      CHECK(map.begin() == map.end());
+      CHECK(map.erase(1) == 0);
+   }
+   TEST_CASE("insert & find")
+   {
+      util::flat_hash_map<int, std::string> map;
+
+      const auto [it, inserted] = map.insert({1, "one"});
+      CHECK(inserted);
+      CHECK(it->first == 1);
+      CHECK(it->second == "one");
+
+      const auto [same, inserted_again] = map.try_emplace(1, "uno");
+      CHECK_FALSE(inserted_again);
+      CHECK(same == it);
+      CHECK(same->second == "one");
+
+      CHECK(map.size() == 1);
+      CHECK(map.contains(1));
+      CHECK_FALSE(map.contains(2));
+   }
+   TEST_CASE("growth keeps references")
+   {
+      constexpr int count = 10'000;
+
+      util::flat_hash_map<int, int> map;
+
+      const auto* p_first = &map.try_emplace(0, 0).first->second;
+      for (int i = 1; i < count; ++i)
+      {
+         map.try_emplace(i, i * 2);
+      }
+
+      CHECK(map.size() == count);
+      CHECK(&map.find(0)->second == p_first);
+
+      for (int i = 0; i < count; ++i)
+      {
+         const auto it = map.find(i);
+         REQUIRE(it != map.end());
+         CHECK(it->second == i * 2);
+      }
+
+      std::size_t visited = 0;
+      for (const auto& [key, value] : map)
+      {
+         CHECK(value == key * 2);
+         ++visited;
+      }
+      CHECK(visited == count);
+   }
+   TEST_CASE("erase")
+   {
+      constexpr int count = 1'000;
+
+      util::flat_hash_map<int, std::unique_ptr<int>> map;
+      for (int i = 0; i < count; ++i)
+      {
+         map.try_emplace(i, std::make_unique<int>(i));
+      }
+
+      for (int i = 0; i < count; i += 2)
+      {
+         CHECK(map.erase(i) == 1);
+      }
+
+      CHECK(map.size() == count / 2);
+      for (int i = 0; i < count; ++i)
+      {
+         CHECK(map.contains(i) == (i % 2 == 1));
+      }
+
+      // erased slots and entries are reused
+      const auto capacity = map.capacity();
+      for (int round = 0; round < 8; ++round)
+      {
+         for (int i = 0; i < count; i += 2)
+         {
+            map.try_emplace(i, std::make_unique<int>(i));
+         }
+         for (int i = 0; i < count; i += 2)
+         {
+            map.erase(map.find(i));
+         }
+      }
+
+      CHECK(map.capacity() == capacity);
+      CHECK(map.size() == count / 2);
+      CHECK(*map.find(count - 1)->second == count - 1);
+   }
+   TEST_CASE("heterogeneous lookup")
+   {
+      util::flat_hash_map<std::string, int, string_hash, std::equal_to<>> map;
+      map.try_emplace(std::string{"main"}, 1);
+      map.try_emplace(std::string{"func"}, 2);
+
+      const std::string_view name = "func";
+      REQUIRE(map.find(name) != map.end());
+      CHECK(map.find(name)->second == 2);
+      CHECK(map.contains("main"));
+      CHECK_FALSE(map.contains(std::string_view{"other"}));
+   }
+   TEST_CASE("move")
+   {
+      util::flat_hash_map<int, std::string> map;
+      for (int i = 0; i < 100; ++i)
+      {
+         map.try_emplace(i, fmt::format("{}", i));
+      }
+
+      auto moved = std::move(map);
+      CHECK(moved.size() == 100);
+      CHECK(moved.find(42)->second == "42");
+
+      map = std::move(moved);
+      CHECK(map.size() == 100);
+      CHECK(map.find(99)->second == "99");
+
+      map.clear();
+      CHECK(map.empty());
+      CHECK(map.find(99) == map.end());
+   }
+}
@@ -0,0 +1,80 @@
+/**
+ * @file parallel_for.hpp
+ * @brief Contains a fork-join loop spreading independent iterations over several threads
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace util
+{
+   /**
+    * @brief The number of threads the hardware runs at once, at least 1
+    */
+   inline auto hardware_thread_count() -> std::size_t
+   {
+      return std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1});
+   }
+
+   /**
+    * @brief Call `fn` once with every index in `[0, count)`, spreading the calls over up to
+    * `thread_count` threads, the calling thread included. Indices are handed out one at a time,
+    * so threads given cheap iterations move on to the next ones instead of waiting. Returns once
+    * every call is done.
+    *
+    * With a single thread the calls are made in order on the calling thread, otherwise `fn` must
+    * be safe to call from several threads at once
+    */
+   template <std::invocable<std::size_t> Fn>
+   void parallel_for(std::size_t count, std::size_t thread_count, Fn&& fn)
+   {
+      thread_count = std::min(thread_count, count);
+      if (thread_count <= 1)
+      {
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            fn(i);
+         }
+
+         return;
+      }
+
+      std::atomic<std::size_t> next{0};
+      const auto work = [&] {
+         for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+              i = next.fetch_add(1, std::memory_order_relaxed))
+         {
+            fn(i);
+         }
+      };
+
+      std::vector<std::jthread> workers;
+      workers.reserve(thread_count - 1);
+      for (std::size_t i = 1; i < thread_count; ++i)
+      {
+         workers.emplace_back(work);
+      }
+
+      work();
+   }
+} // namespace util
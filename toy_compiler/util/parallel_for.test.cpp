@@ -0,0 +1,67 @@
+/**
+ * @brief Runs tests on functions defined in parallel_for.hpp
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <toy_compiler/util/parallel_for.hpp>
+
+#include <atomic>
+#include <vector>
+
+TEST_SUITE("parallel_for test suite")
+{
+   TEST_CASE("a single thread calls in order")
+   {
+      std::vector<std::size_t> indices;
+      util::parallel_for(5, 1, [&](std::size_t i) {
+         indices.push_back(i);
+      });
+
+      CHECK(indices == std::vector<std::size_t>{0, 1, 2, 3, 4});
+   }
+   TEST_CASE("every index is called once")
+   {
+      constexpr std::size_t count = 1000;
+
+      std::vector<std::atomic<int>> calls(count);
+      util::parallel_for(count, 4, [&](std::size_t i) {
+         calls[i].fetch_add(1);
+      });
+
+      for (const auto& call : calls)
+      {
+         CHECK(call.load() == 1);
+      }
+   }
+   TEST_CASE("more threads than indices")
+   {
+      std::atomic<int> calls{0};
+      util::parallel_for(3, 16, [&](std::size_t) {
+         calls.fetch_add(1);
+      });
+
+      CHECK(calls.load() == 3);
+
+      util::parallel_for(0, 16, [&](std::size_t) {
+         calls.fetch_add(1);
+      });
+
+      CHECK(calls.load() == 3);
+   }
+}